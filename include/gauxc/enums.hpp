@@ -51,6 +51,25 @@ enum class ExecutionSpace {
   Device ///< Execute task on the device (e.g. GPU)
 };
 
+/**
+ *  @brief Specification of the shell pair integral engine for sn-LinK
+ */
+enum class ShellPairIntegralEngine {
+  Auto,       ///< Select the faster engine per (la,lb,nprim_pair) class at runtime
+  ObaraSaika, ///< Obara-Saika recursion
+  Rys         ///< Rys quadrature
+};
+
+/**
+ *  @brief Specification of the order in which the local quadrature tasks
+ *  are processed by the host integrators
+ */
+enum class TaskOrdering {
+  Size,    ///< Decreasing task size (npts x nbe), dynamic scheduling
+  Morton,  ///< Morton curve through the task centroids, locality-aware scheduling
+  Hilbert  ///< Hilbert curve through the task centroids, locality-aware scheduling
+};
+
 /// Supported Algorithms / Integrands
 enum class SupportedAlg {
   XC,
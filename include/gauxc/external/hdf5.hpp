@@ -9,6 +9,7 @@
 #ifdef GAUXC_HAS_HDF5
 #include <gauxc/shell.hpp>
 #include <gauxc/atom.hpp>
+#include <gauxc/load_balancer.hpp>
 
 namespace GauXC {
 void write_hdf5_record( const std::vector<Shell<double>>& shell, std::string fname, std::string dset );
@@ -16,6 +17,25 @@ void write_hdf5_record( const std::vector<Atom>& mol, std::string fname, std::st
 void read_hdf5_record( std::vector<Shell<double>>& shell, std::string fname, std::string dset );
 void read_hdf5_record( std::vector<Atom>& mol, std::string fname, std::string dset );
 
+/**
+ *  @brief Save the local quadrature tasks (points, weights, basis screening)
+ *  and the state of a LoadBalancer
+ *
+ *  Each rank writes its local tasks to its own file, fname for a single rank
+ *  and fname.<rank> otherwise. The record is stored in the group dset.
+ */
+void write_hdf5_record( LoadBalancer& lb, std::string fname, std::string dset );
+
+/**
+ *  @brief Restore the local quadrature tasks and state of a LoadBalancer
+ *  saved by write_hdf5_record
+ *
+ *  lb must have been constructed for the same molecule and basis on the same
+ *  number of ranks as the saved instance. Its tasks are replaced by the saved
+ *  ones, so no quadrature generation or screening takes place.
+ */
+void read_hdf5_record( LoadBalancer& lb, std::string fname, std::string dset );
+
 #if 0
 void write_hdf5_record( int32_t M, int32_t N, const double* A, int32_t LDA, std::string fname, std::string dset );
 void read_hdf5_record( int32_t M, int32_t N, double* A, int32_t LDA, std::string fname, std::string dset );
@@ -15,6 +15,7 @@
 #include <gauxc/xc_task.hpp>
 #include <gauxc/util/timer.hpp>
 #include <gauxc/runtime_environment.hpp>
+#include <gauxc/enums.hpp>
 
 namespace GauXC {
 
@@ -27,6 +28,12 @@ namespace detail {
 struct LoadBalancerState {
   bool modified_weights_are_stored = false; 
     ///< Whether the load balancer currently stores partitioned weights
+  bool exx_costs_measured = false;
+    ///< Whether the local tasks carry measured EXX costs (XCTask::cost_exx_measured)
+  XCWeightAlg weight_alg = XCWeightAlg::SSF;
+    ///< Partitioning scheme of the stored weights (if modified)
+  bool tasks_compacted = false;
+    ///< Whether negligible points have been removed from the local tasks
 };
 
 
@@ -62,18 +69,112 @@ public:
 
   /// Get underlying (local) quadrature tasks for this process (cost)
   const std::vector<XCTask>& get_tasks() const;
-  /// Get underlying (local) quadrature tasks for this process (non-cost)
+  /// Get underlying (local) quadrature tasks for this process (non-cost),
+  /// increments the task generation
         std::vector<XCTask>& get_tasks()      ;
 
+  /// Return the generation of the local tasks: incremented by every 
+  /// operation which may modify the tasks (set_tasks, non-const get_tasks,
+  /// reorder_tasks, rebalance_*, update_*, adapt_task_sizes, compact_tasks),
+  /// such that data derived from the tasks may be cached on it
+  size_t generation() const;
+
+  /// Replace the (local) quadrature tasks for this process, e.g. with tasks
+  /// restored from a previous run on the same molecule / grid / basis
+  void set_tasks( std::vector<XCTask>&& tasks );
+
+  /// Reorder the local tasks such that task i is the current task perm[i].
+  /// The task generation is only incremented if the order changes
+  void reorder_tasks( const std::vector<size_t>& perm );
+
+  /// Whether the local tasks have been generated (or set). The same on all
+  /// ranks, a rank may hold no local tasks
+  bool tasks_generated() const;
+
   /// Rebalance quadrature batches according to weight-only cost
   void rebalance_weights();
 
   /// Rebalance quadrature batches according to exc-vxc cost
   void rebalance_exc_vxc();
 
-  /// Rebalance quadrature batches according to exx cost 
+  /// Rebalance quadrature batches according to exx cost. The task costs
+  /// measured by the last EXX evaluation are used if available on all
+  /// ranks, otherwise the XCTask::cost_exx estimate
   void rebalance_exx();
   
+  /**
+   *  @brief Update the LoadBalancer for a new geometry of the same molecule
+   *
+   *  The local tasks and their MPI assignment are kept: quadrature points
+   *  move with their parent atom and the basis screening of each task is
+   *  redone. Partitioned weights are reset to the quadrature weights and
+   *  must be modified again. The tasks are rebalanced if the cost of any
+   *  rank changes by more than rebalance_threshold (relative), and are 
+   *  regenerated if previously negligible batches are no longer negligible.
+   *
+   *  @param[in] mol                 Molecule with the new atomic positions
+   *  @param[in] rebalance_threshold Relative change of the local task cost
+   *                                 above which the tasks are rebalanced
+   */
+  void update_geometry( const Molecule& mol, double rebalance_threshold = 0.1 );
+
+  /**
+   *  @brief Update the LoadBalancer for a new basis set on the same molecule
+   *
+   *  Only the basis screening is redone: the quadrature points of the local
+   *  tasks and their (partitioned) weights are basis independent and are 
+   *  kept together with the MPI assignment, such that one partitioned grid
+   *  may serve several basis sets (e.g. through copies of the LoadBalancer).
+   *  This includes compacted tasks (see compact_tasks) and the measured EXX
+   *  costs. Tasks which become negligible are dropped and tasks which become
+   *  equivalent are merged. If batches which were negligible for the 
+   *  previous basis are not negligible for the new one, the tasks are 
+   *  regenerated and the weights must be modified again: the LoadBalancer
+   *  should be generated with the most diffuse of the basis sets. The tasks
+   *  are rebalanced if the cost of any rank changes by more than 
+   *  rebalance_threshold (relative).
+   *
+   *  @param[in] bs                  New (electronic) basis set
+   *  @param[in] protonic_bs         New protonic basis set (NEO)
+   *  @param[in] rebalance_threshold Relative change of the local task cost
+   *                                 above which the tasks are rebalanced
+   */
+  void update_basis( const basis_type& bs, double rebalance_threshold = 0.1 );
+  void update_basis( const basis_type& bs, const basis_type& protonic_bs, 
+    double rebalance_threshold = 0.1 );
+  
+  /**
+   *  @brief Split and merge the local tasks towards a window of task cost
+   *  (XCTask::cost)
+   *
+   *  Tasks above max_cost are recursively bisected along the longest extent
+   *  of their points and rescreened. Tasks below min_cost are merged with a
+   *  nearby task of the same parent atom if the merged task stays below 
+   *  max_cost and its nbe grows by at most max_nbe_growth (relative) over
+   *  the larger of the two. Quadrature weights (partitioned or not) are 
+   *  carried over unchanged.
+   */
+  void adapt_task_sizes( size_t min_cost, size_t max_cost, 
+    double max_nbe_growth = 0.1 );
+
+  /**
+   *  @brief Remove the quadrature points with negligible partitioned weights
+   *  from the local tasks
+   *
+   *  Points with |weight| <= weight_tol are removed. Tasks which lose points
+   *  are rescreened against the bounding box of their remaining points,
+   *  tasks without points or basis functions are dropped and tasks which 
+   *  become equivalent are merged. The tasks are rebalanced if the cost of
+   *  any rank changes by more than rebalance_threshold (relative). Requires 
+   *  modified weights (see MolecularWeights). The compacted tasks are kept
+   *  by update_basis, update_geometry regenerates the full quadrature.
+   *
+   *  @param[in] weight_tol          Weight tolerance
+   *  @param[in] rebalance_threshold Relative change of the local task cost
+   *                                 above which the tasks are rebalanced
+   */
+  void compact_tasks( double weight_tol, double rebalance_threshold = 0.1 );
+
   /// Return internal timing tracker
   const util::Timer& get_timings() const;
 
@@ -102,6 +203,10 @@ public:
   const shell_pair_type& shell_pairs() const;
   const shell_pair_type& shell_pairs();
 
+  /// Return the shell pairs for this LoadBalancer with far-field multipole
+  /// moments generated
+  const shell_pair_type& shell_pairs_with_multipoles();
+
   /// Return the underlying protonic BasisSet instance used to generate this LoadBalancer 
   const basis_type& protonic_basis()  const;
 
@@ -147,6 +252,12 @@ public:
    *                           This gurantees contiguous memory access but leads
    *                           to significantly more work. Not advised for general 
    *                           usage
+   *    - "DISTRIBUTED": Read as "DISTRIBUTED-PETITE"
+   *    - "DISTRIBUTED-PETITE", "DISTRIBUTED-FILLIN": Same tasks and MPI 
+   *                           assignment as the corresponding REPLICATED
+   *                           kernels, but the batch generation and screening
+   *                           is partitioned across ranks instead of being
+   *                           replicated on each rank
    * 
    *    Currently accepted values for Device execution space:
    *      - "DEFAULT": Read as "REPLICATED"
@@ -20,6 +20,9 @@ namespace detail {
 struct MolecularWeightsSettings { 
     XCWeightAlg weight_alg = XCWeightAlg::SSF; ///< Weight partitioning scheme
     bool becke_size_adjustment = false; ///< Whether to use Becke size adjustments
+    bool neighbor_list = false; ///< Whether to screen Becke / SSF weights with neighbor lists (host only)
+    bool compact_tasks = false; ///< Whether to remove negligible points after partitioning (see LoadBalancer::compact_tasks)
+    double compaction_tol = 0.; ///< Weight tolerance of the task compaction
 };
 
 
@@ -55,7 +58,8 @@ public:
   // Move a MolecularWeights instance
   MolecularWeights( MolecularWeights&& ) noexcept;
 
-  /// Apply weight partitioning scheme to pre-generated local quadrature tasks
+  /// Apply weight partitioning scheme to pre-generated local quadrature tasks,
+  /// and compact the tasks if requested
   void modify_weights(load_balancer_reference lb) const;
 
   /// Return local timing tracker
@@ -11,6 +11,8 @@
 #include <gauxc/exceptions.hpp>
 
 #include <cstdint>
+#include <cmath>
+#include <limits>
 
 namespace GauXC {
 namespace detail {
@@ -41,6 +43,38 @@ struct PrimitivePair {
   F gamma_inv;
 };
 
+/**
+ *  @brief Low-order Cartesian multipole moments of the charge distributions
+ *  of a shell pair
+ *
+ *  Moments are stored for each Cartesian component pair (a,b) of the
+ *  (higher-l, lower-l) shells in the order
+ *  (q, dx, dy, dz, Qxx, Qxy, Qxz, Qyy, Qyz, Qzz) about a common center.
+ */
+template <typename F>
+struct ShellPairMultipoles {
+  static constexpr int nmoments = 10;
+
+  std::vector<F>          moments;  ///< Moments ((ncart_a * ncart_b), nmoments)
+  detail::cartesian_point center;   ///< Expansion center
+  F extent       = 0.; ///< Max distance of a primitive pair center from center
+  F gamma_min    = std::numeric_limits<F>::infinity(); ///< Most diffuse exponent
+  F charge_bound = 0.; ///< Upper bound on the magnitude of the distribution
+
+  inline bool empty() const { return moments.empty(); }
+
+  /// Distance beyond which the multipole expansion is accurate to tol
+  inline F far_field_radius( F tol ) const {
+    // Penetration: the most diffuse primitive pair has decayed below tol
+    const auto r_pen = extent + std::sqrt( -std::log(tol) / gamma_min );
+    // Truncation: neglected octupole ~ charge_bound * r_spread^3 / R^4
+    const auto r_spread = extent + 1. / std::sqrt( gamma_min );
+    const auto r_trunc =
+      std::pow( charge_bound * r_spread * r_spread * r_spread / tol, 0.25 );
+    return std::max( r_pen, r_trunc );
+  }
+};
+
 template <typename F>
 class ShellPair {
 
@@ -48,6 +82,7 @@ class ShellPair {
   using const_shell_ref = const shell_type&;
 
   std::vector<PrimitivePair<F>> prim_pairs_;
+  ShellPairMultipoles<F>        multipoles_;
 
   void generate( const_shell_ref bra, const_shell_ref ket ) {
 
@@ -97,6 +132,126 @@ class ShellPair {
     } // loop over prim pairs
   } // generate
 
+  void generate_multipoles_( const_shell_ref bra, const_shell_ref ket ) {
+
+    const int la = bra.l();
+    const int lb = ket.l();
+    const int ncart_a = bra.cart_size();
+    const int ncart_b = ket.cart_size();
+    const auto nmom = ShellPairMultipoles<F>::nmoments;
+
+    multipoles_ = ShellPairMultipoles<F>();
+    multipoles_.moments.resize( ncart_a * ncart_b * nmom, 0. );
+    if( prim_pairs_.empty() ) return;
+
+    // Expansion center: |K| weighted average of the primitive pair centers
+    auto& O = multipoles_.center;
+    O = {0., 0., 0.};
+    F K_sum = 0.;
+    for( const auto& pp : prim_pairs_ ) {
+      const auto K_abs = std::abs(pp.K_coeff_prod);
+      O.x += K_abs * pp.P.x; O.y += K_abs * pp.P.y; O.z += K_abs * pp.P.z;
+      K_sum += K_abs;
+    }
+    if( K_sum > 0. ) {
+      O.x /= K_sum; O.y /= K_sum; O.z /= K_sum;
+    } else {
+      // All primitive products underflow (vanishing moments), fall back to
+      // the unweighted average
+      O = {0., 0., 0.};
+      for( const auto& pp : prim_pairs_ ) {
+        O.x += pp.P.x; O.y += pp.P.y; O.z += pp.P.z;
+      }
+      const F oo_n = F(1) / prim_pairs_.size();
+      O.x *= oo_n; O.y *= oo_n; O.z *= oo_n;
+    }
+
+    // 1D overlap-type moments (x_A^i x_B^j (x - O)^e), e = 0..2
+    const int ldj = lb + 3;
+    std::vector<F> S( (la+1) * ldj );
+    std::vector<F> M( 3 * 3 * (la+1) * (lb+1) );
+    auto M_idx = [&]( int d, int e, int i, int j ) {
+      return j + (lb+1) * (i + (la+1) * (e + 3*d));
+    };
+
+    for( const auto& pp : prim_pairs_ ) {
+      const auto g     = pp.gamma;
+      const auto oo_2g = 0.5 * pp.gamma_inv;
+
+      // c_a * c_b * exp(-mu * AB^2)
+      const auto pref  = pp.K_coeff_prod * g / (2. * M_PI);
+
+      const F PA[3] = { pp.PA.x, pp.PA.y, pp.PA.z };
+      const F PB[3] = { pp.PB.x, pp.PB.y, pp.PB.z };
+      const F BO[3] = { pp.P.x - pp.PB.x - O.x, pp.P.y - pp.PB.y - O.y,
+                        pp.P.z - pp.PB.z - O.z };
+
+      for( int d = 0; d < 3; ++d ) {
+        // Obara-Saika recursion for 1D overlaps
+        auto S_ = [&](int i, int j) -> F& { return S[j + i*ldj]; };
+        S_(0,0) = std::sqrt( M_PI * pp.gamma_inv );
+        for( int i = 0; i < la; ++i )
+          S_(i+1,0) = PA[d] * S_(i,0) + (i ? i*oo_2g*S_(i-1,0) : 0.);
+        for( int i = 0; i <= la; ++i )
+        for( int j = 0; j < lb + 2; ++j ) {
+          F tmp = PB[d] * S_(i,j);
+          if(i) tmp += i * oo_2g * S_(i-1,j);
+          if(j) tmp += j * oo_2g * S_(i,j-1);
+          S_(i,j+1) = tmp;
+        }
+
+        // (x - O) = (x - B) + (B - O)
+        for( int i = 0; i <= la; ++i )
+        for( int j = 0; j <= lb; ++j ) {
+          M[M_idx(d,0,i,j)] = S_(i,j);
+          M[M_idx(d,1,i,j)] = S_(i,j+1) + BO[d] * S_(i,j);
+          M[M_idx(d,2,i,j)] = S_(i,j+2) + 2. * BO[d] * S_(i,j+1) +
+                              BO[d] * BO[d] * S_(i,j);
+        }
+      }
+
+      // Assemble moments over Cartesian component pairs
+      auto* mom = multipoles_.moments.data();
+      for( int ax = la, ia = 0; ax >= 0; --ax )
+      for( int az = 0; az <= la - ax; ++az, ++ia ) {
+        const int ay = la - ax - az;
+        for( int bx = lb, ib = 0; bx >= 0; --bx )
+        for( int bz = 0; bz <= lb - bx; ++bz, ++ib ) {
+          const int by = lb - bx - bz;
+
+          const F x0 = M[M_idx(0,0,ax,bx)], x1 = M[M_idx(0,1,ax,bx)],
+                  x2 = M[M_idx(0,2,ax,bx)];
+          const F y0 = M[M_idx(1,0,ay,by)], y1 = M[M_idx(1,1,ay,by)],
+                  y2 = M[M_idx(1,2,ay,by)];
+          const F z0 = M[M_idx(2,0,az,bz)], z1 = M[M_idx(2,1,az,bz)],
+                  z2 = M[M_idx(2,2,az,bz)];
+
+          auto* m_ab = mom + (ib + ia*ncart_b) * nmom;
+          m_ab[0] += pref * x0 * y0 * z0;
+          m_ab[1] += pref * x1 * y0 * z0;
+          m_ab[2] += pref * x0 * y1 * z0;
+          m_ab[3] += pref * x0 * y0 * z1;
+          m_ab[4] += pref * x2 * y0 * z0;
+          m_ab[5] += pref * x1 * y1 * z0;
+          m_ab[6] += pref * x1 * y0 * z1;
+          m_ab[7] += pref * x0 * y2 * z0;
+          m_ab[8] += pref * x0 * y1 * z1;
+          m_ab[9] += pref * x0 * y0 * z2;
+        }
+      }
+
+      // Spatial extent / magnitude of the distribution
+      const auto dPx = pp.P.x - O.x;
+      const auto dPy = pp.P.y - O.y;
+      const auto dPz = pp.P.z - O.z;
+      multipoles_.extent = std::max( multipoles_.extent,
+        std::sqrt( dPx*dPx + dPy*dPy + dPz*dPz ) );
+      multipoles_.gamma_min = std::min( multipoles_.gamma_min, g );
+      multipoles_.charge_bound += std::abs(pref) * 
+        std::pow( M_PI * pp.gamma_inv, 1.5 );
+    } // loop over prim pairs
+  } // generate_multipoles_
+
 public:
 
   ShellPair() = default;
@@ -111,6 +266,16 @@ public:
 
   inline size_t nprim_pairs() const { return prim_pairs_.size(); }
 
+  /// Generate far-field multipole moments, ordering of bra/ket as in ctor
+  void generate_multipoles( const Shell<F>& bra, const Shell<F>& ket ) {
+    if( bra.l() >= ket.l() ) generate_multipoles_(bra,ket);
+    else                     generate_multipoles_(ket,bra);
+  }
+
+  inline const ShellPairMultipoles<F>& multipoles() const { 
+    return multipoles_; 
+  }
+
 };
 
 
@@ -120,6 +285,7 @@ class ShellPairCollection {
   std::vector<ShellPair<F>> shell_pairs_;
   std::vector<size_t> row_ptr_, col_ind_;
   ShellPair<F> dummy;
+  bool has_multipoles_ = false;
 
 public:
   ShellPairCollection( const BasisSet<F>& basis ) {
@@ -143,6 +309,18 @@ public:
     }    
   }
 
+  /// Generate far-field multipole moments for all shell pairs
+  void generate_multipoles( const BasisSet<F>& basis ) {
+    if( has_multipoles_ ) return;
+    for(size_t i = 0; i < nshells_; ++i) 
+    for(size_t _j = row_ptr_[i]; _j < row_ptr_[i+1]; ++_j) {
+      shell_pairs_[_j].generate_multipoles( basis[i], basis[col_ind_[_j]] );
+    }
+    has_multipoles_ = true;
+  }
+
+  inline bool has_multipoles() const { return has_multipoles_; }
+
   inline int64_t get_linear_shell_pair_index(size_t i, size_t j) const {
     return detail::csr_index(i, j, row_ptr_.data(), col_ind_.data());
   }
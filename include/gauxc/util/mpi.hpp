@@ -19,10 +19,9 @@ namespace GauXC {
 namespace detail {
 template <typename InputIt, typename OutputIt, typename T>
 OutputIt exclusive_scan(InputIt begin, InputIt end, OutputIt d_first, T init) {
-  *(d_first++) = init;
   T sum = init;
   for(auto it = begin; it != end; ++it) {
-    *(d_first++) = *it + sum;
+    *(d_first++) = sum;
     sum += *it;
   }
   return d_first;
@@ -38,6 +38,8 @@ public:
   using exc_vxc_type_neo_uks = std::tuple< value_type, value_type, matrix_type, matrix_type, matrix_type, matrix_type >;  
   using exc_grad_type = std::vector< value_type >;
   using exx_type      = matrix_type;
+  using coulomb_type  = matrix_type;
+  using coulomb_exx_type = std::tuple< matrix_type, matrix_type >;
 
 private:
 
@@ -72,10 +74,18 @@ public:
   exc_vxc_type_neo_uks neo_eval_exc_vxc ( const MatrixType&, const MatrixType&, const MatrixType&, const MatrixType&,
                                           const IntegratorSettingsXC& = IntegratorSettingsXC{} );
 
-  exc_grad_type eval_exc_grad( const MatrixType& );
+  exc_grad_type eval_exc_grad( const MatrixType&, const IntegratorSettingsXC& = IntegratorSettingsXC{} );
 
   exx_type      eval_exx     ( const MatrixType&, 
                                const IntegratorSettingsEXX& = IntegratorSettingsEXX{} );
+  value_type    eval_exx_energy( const MatrixType&,
+                               const IntegratorSettingsEXX& = IntegratorSettingsEXX{} );
+
+  coulomb_type  eval_coulomb ( const MatrixType&,
+                               const IntegratorSettingsCoulomb& = IntegratorSettingsCoulomb{} );
+  coulomb_exx_type eval_coulomb_exx( const MatrixType&,
+                               const IntegratorSettingsCoulomb& = IntegratorSettingsCoulomb{},
+                               const IntegratorSettingsEXX& = IntegratorSettingsEXX{} );
 
 
   const util::Timer& get_timings() const;
@@ -93,9 +93,9 @@ typename XCIntegrator<MatrixType>::exc_vxc_type_neo_uks
 
 template <typename MatrixType>
 typename XCIntegrator<MatrixType>::exc_grad_type
-  XCIntegrator<MatrixType>::eval_exc_grad( const MatrixType& P ) {
+  XCIntegrator<MatrixType>::eval_exc_grad( const MatrixType& P, const IntegratorSettingsXC& ks_settings ) {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
-  return pimpl_->eval_exc_grad(P);
+  return pimpl_->eval_exc_grad(P, ks_settings);
 };
 
 template <typename MatrixType>
@@ -106,6 +106,31 @@ typename XCIntegrator<MatrixType>::exx_type
   return pimpl_->eval_exx(P,settings);
 };
 
+template <typename MatrixType>
+typename XCIntegrator<MatrixType>::value_type
+  XCIntegrator<MatrixType>::eval_exx_energy( const MatrixType&     P,
+                                             const IntegratorSettingsEXX& settings ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->eval_exx_energy(P,settings);
+};
+
+template <typename MatrixType>
+typename XCIntegrator<MatrixType>::coulomb_type
+  XCIntegrator<MatrixType>::eval_coulomb( const MatrixType&     P,
+                                          const IntegratorSettingsCoulomb& settings ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->eval_coulomb(P,settings);
+};
+
+template <typename MatrixType>
+typename XCIntegrator<MatrixType>::coulomb_exx_type
+  XCIntegrator<MatrixType>::eval_coulomb_exx( const MatrixType&     P,
+                                              const IntegratorSettingsCoulomb& cou_settings,
+                                              const IntegratorSettingsEXX& exx_settings ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->eval_coulomb_exx(P,cou_settings,exx_settings);
+};
+
 template <typename MatrixType>
 const util::Timer& XCIntegrator<MatrixType>::get_timings() const {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
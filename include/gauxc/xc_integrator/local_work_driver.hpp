@@ -34,7 +34,8 @@ public:
   /** Generate a LWD instance
    * 
    *  @param[in] ex        The Execution space for the LWD driver
-   *  @param[in] name      The name of the LWD driver to construct (e.g. "Default" or "Reference")
+   *  @param[in] name      The name of the LWD driver to construct (e.g. "Default", "Reference" or,
+   *                       for the Host, "SIMD")
    *  @param[in] settings  Settings to pass to LWD construction
    */
   static ptr_return_t make_local_work_driver(ExecutionSpace ex, 
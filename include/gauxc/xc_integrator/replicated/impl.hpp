@@ -212,13 +212,13 @@ typename ReplicatedXCIntegrator<MatrixType>::exc_vxc_type_neo_uks
 
 template <typename MatrixType>
 typename ReplicatedXCIntegrator<MatrixType>::exc_grad_type 
-  ReplicatedXCIntegrator<MatrixType>::eval_exc_grad_( const MatrixType& P ) {
+  ReplicatedXCIntegrator<MatrixType>::eval_exc_grad_( const MatrixType& P, const IntegratorSettingsXC& ks_settings ) {
 
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
 
   std::vector<value_type> EXC_GRAD( 3*pimpl_->load_balancer().molecule().natoms() );
   pimpl_->eval_exc_grad( P.rows(), P.cols(), P.data(), P.rows(),
-                         EXC_GRAD.data() );
+                         EXC_GRAD.data(), ks_settings );
 
   return EXC_GRAD;
 
@@ -239,5 +239,54 @@ typename ReplicatedXCIntegrator<MatrixType>::exx_type
 
 }
 
+template <typename MatrixType>
+typename ReplicatedXCIntegrator<MatrixType>::value_type 
+  ReplicatedXCIntegrator<MatrixType>::eval_exx_energy_( const MatrixType& P, const IntegratorSettingsEXX& settings ) {
+
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  
+  value_type EXX;
+
+  pimpl_->eval_exx_energy( P.rows(), P.cols(), P.data(), P.rows(),
+                           &EXX, settings );
+
+  return EXX;
+
+}
+
+template <typename MatrixType>
+typename ReplicatedXCIntegrator<MatrixType>::coulomb_type 
+  ReplicatedXCIntegrator<MatrixType>::eval_coulomb_( const MatrixType& P, const IntegratorSettingsCoulomb& settings ) {
+
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  
+  matrix_type J( P.rows(), P.cols() );
+
+  pimpl_->eval_coulomb( P.rows(), P.cols(), P.data(), P.rows(),
+                        J.data(), J.rows(), settings );
+
+  return J;
+
+}
+
+template <typename MatrixType>
+typename ReplicatedXCIntegrator<MatrixType>::coulomb_exx_type 
+  ReplicatedXCIntegrator<MatrixType>::eval_coulomb_exx_( const MatrixType& P, 
+    const IntegratorSettingsCoulomb& cou_settings,
+    const IntegratorSettingsEXX& exx_settings ) {
+
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  
+  matrix_type J( P.rows(), P.cols() );
+  matrix_type K( P.rows(), P.cols() );
+
+  pimpl_->eval_coulomb_exx( P.rows(), P.cols(), P.data(), P.rows(),
+                            J.data(), J.rows(), K.data(), K.rows(), 
+                            cou_settings, exx_settings );
+
+  return std::make_tuple( J, K );
+
+}
+
 }
 }
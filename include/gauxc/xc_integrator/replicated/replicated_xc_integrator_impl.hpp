@@ -93,10 +93,22 @@ protected:
                                   value_type* prot_VXCz,     int64_t prot_ldvxcz,
                                   value_type* elec_EXC,  value_type* prot_EXC, const IntegratorSettingsXC& ks_settings) = 0;
   virtual void eval_exc_grad_( int64_t m, int64_t n, const value_type* P,
-                               int64_t ldp, value_type* EXC_GRAD ) = 0;
+                               int64_t ldp, value_type* EXC_GRAD, 
+                               const IntegratorSettingsXC& ks_settings ) = 0;
   virtual void eval_exx_( int64_t m, int64_t n, const value_type* P,
                           int64_t ldp, value_type* K, int64_t ldk,
                           const IntegratorSettingsEXX& settings ) = 0;
+  virtual void eval_exx_energy_( int64_t m, int64_t n, const value_type* P,
+                                 int64_t ldp, value_type* EXX,
+                                 const IntegratorSettingsEXX& settings ) = 0;
+  virtual void eval_coulomb_( int64_t m, int64_t n, const value_type* P,
+                              int64_t ldp, value_type* J, int64_t ldj,
+                              const IntegratorSettingsCoulomb& settings ) = 0;
+  virtual void eval_coulomb_exx_( int64_t m, int64_t n, const value_type* P,
+                                  int64_t ldp, value_type* J, int64_t ldj,
+                                  value_type* K, int64_t ldk,
+                                  const IntegratorSettingsCoulomb& cou_settings,
+                                  const IntegratorSettingsEXX& exx_settings ) = 0;
 
 public:
 
@@ -175,12 +187,27 @@ public:
                          value_type* elec_EXC,  value_type* prot_EXC, const IntegratorSettingsXC& ks_settings );
 
   void eval_exc_grad( int64_t m, int64_t n, const value_type* P,
-                      int64_t ldp, value_type* EXC_GRAD );
+                      int64_t ldp, value_type* EXC_GRAD, 
+                      const IntegratorSettingsXC& ks_settings );
 
   void eval_exx( int64_t m, int64_t n, const value_type* P,
                  int64_t ldp, value_type* K, int64_t ldk,
                  const IntegratorSettingsEXX& settings );
 
+  void eval_exx_energy( int64_t m, int64_t n, const value_type* P,
+                        int64_t ldp, value_type* EXX,
+                        const IntegratorSettingsEXX& settings );
+
+  void eval_coulomb( int64_t m, int64_t n, const value_type* P,
+                     int64_t ldp, value_type* J, int64_t ldj,
+                     const IntegratorSettingsCoulomb& settings );
+
+  void eval_coulomb_exx( int64_t m, int64_t n, const value_type* P,
+                         int64_t ldp, value_type* J, int64_t ldj,
+                         value_type* K, int64_t ldk,
+                         const IntegratorSettingsCoulomb& cou_settings,
+                         const IntegratorSettingsEXX& exx_settings );
+
   inline const util::Timer& get_timings() const { return timer_; }
 
   inline std::unique_ptr< LocalWorkDriver > release_local_work_driver() {
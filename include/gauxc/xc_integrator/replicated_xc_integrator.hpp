@@ -35,6 +35,8 @@ public:
   using exc_vxc_type_neo_uks   = typename XCIntegratorImpl<MatrixType>::exc_vxc_type_neo_uks;
   using exc_grad_type  = typename XCIntegratorImpl<MatrixType>::exc_grad_type;
   using exx_type       = typename XCIntegratorImpl<MatrixType>::exx_type;
+  using coulomb_type   = typename XCIntegratorImpl<MatrixType>::coulomb_type;
+  using coulomb_exx_type = typename XCIntegratorImpl<MatrixType>::coulomb_exx_type;
 
 private:
 
@@ -50,8 +52,12 @@ private:
   exc_vxc_type_gks  eval_exc_vxc_ ( const MatrixType&, const MatrixType&, const MatrixType&, const MatrixType&, const IntegratorSettingsXC& ) override;
   exc_vxc_type_neo_rks  neo_eval_exc_vxc_ ( const MatrixType&, const MatrixType&, const MatrixType&, const IntegratorSettingsXC& ) override;
   exc_vxc_type_neo_uks  neo_eval_exc_vxc_ ( const MatrixType&, const MatrixType&, const MatrixType&, const MatrixType&, const IntegratorSettingsXC& ) override;
-  exc_grad_type eval_exc_grad_( const MatrixType& ) override;
+  exc_grad_type eval_exc_grad_( const MatrixType&, const IntegratorSettingsXC& ) override;
   exx_type      eval_exx_     ( const MatrixType&, const IntegratorSettingsEXX& ) override;
+  value_type    eval_exx_energy_( const MatrixType&, const IntegratorSettingsEXX& ) override;
+  coulomb_type  eval_coulomb_ ( const MatrixType&, const IntegratorSettingsCoulomb& ) override;
+  coulomb_exx_type eval_coulomb_exx_( const MatrixType&, const IntegratorSettingsCoulomb&, 
+                                      const IntegratorSettingsEXX& ) override;
   const util::Timer& get_timings_() const override;
   const LoadBalancer& get_load_balancer_() const override;
   LoadBalancer& get_load_balancer_() override;
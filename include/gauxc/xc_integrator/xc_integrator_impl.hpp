@@ -27,6 +27,8 @@ public:
   using exc_vxc_type_neo_uks   = typename XCIntegrator<MatrixType>::exc_vxc_type_neo_uks;
   using exc_grad_type  = typename XCIntegrator<MatrixType>::exc_grad_type;
   using exx_type       = typename XCIntegrator<MatrixType>::exx_type;
+  using coulomb_type   = typename XCIntegrator<MatrixType>::coulomb_type;
+  using coulomb_exx_type = typename XCIntegrator<MatrixType>::coulomb_exx_type;
 
 protected:
 
@@ -44,9 +46,16 @@ protected:
                                                     const IntegratorSettingsXC& ks_settings ) = 0;
   virtual exc_vxc_type_neo_uks  neo_eval_exc_vxc_ ( const MatrixType& elec_Ps, const MatrixType& elec_Pz, const MatrixType& prot_Ps, const MatrixType& prot_Pz,
                                                     const IntegratorSettingsXC& ks_settings ) = 0;
-  virtual exc_grad_type eval_exc_grad_( const MatrixType& P ) = 0;
+  virtual exc_grad_type eval_exc_grad_( const MatrixType& P, const IntegratorSettingsXC& ks_settings ) = 0;
   virtual exx_type      eval_exx_     ( const MatrixType&     P, 
                                         const IntegratorSettingsEXX& settings ) = 0;
+  virtual value_type    eval_exx_energy_( const MatrixType&   P,
+                                        const IntegratorSettingsEXX& settings ) = 0;
+  virtual coulomb_type  eval_coulomb_ ( const MatrixType&     P,
+                                        const IntegratorSettingsCoulomb& settings ) = 0;
+  virtual coulomb_exx_type eval_coulomb_exx_( const MatrixType& P,
+                                        const IntegratorSettingsCoulomb& cou_settings,
+                                        const IntegratorSettingsEXX& exx_settings ) = 0;
   virtual const util::Timer& get_timings_() const = 0;
   virtual const LoadBalancer& get_load_balancer_() const = 0;
   virtual LoadBalancer& get_load_balancer_() = 0;
@@ -130,8 +139,8 @@ public:
    *  @param[in] P The alpha density matrix
    *  @returns EXC gradient
    */
-  exc_grad_type eval_exc_grad( const MatrixType& P ) {
-    return eval_exc_grad_(P);
+  exc_grad_type eval_exc_grad( const MatrixType& P, const IntegratorSettingsXC& ks_settings ) {
+    return eval_exc_grad_(P, ks_settings);
   }
 
   /** Integrate Exact Exchange for RHF
@@ -143,6 +152,35 @@ public:
     return eval_exx_(P,settings);
   }
 
+  /** Integrate Exact Exchange energy E = tr(P K) without forming K
+   *
+   *  @param[in] P The density matrix
+   *  @returns Exact Exchange energy
+   */
+  value_type eval_exx_energy( const MatrixType& P, const IntegratorSettingsEXX& settings ) {
+    return eval_exx_energy_(P,settings);
+  }
+
+  /** Integrate Coulomb matrix (sn-J)
+   *
+   *  @param[in] P The total density matrix
+   *  @returns Coulomb Matrix
+   */
+  coulomb_type eval_coulomb( const MatrixType& P, const IntegratorSettingsCoulomb& settings ) {
+    return eval_coulomb_(P,settings);
+  }
+
+  /** Integrate Coulomb and Exact Exchange matrices in a single pass
+   *
+   *  @param[in] P The density matrix
+   *  @returns Coulomb and Exact Exchange Matrices
+   */
+  coulomb_exx_type eval_coulomb_exx( const MatrixType& P, 
+    const IntegratorSettingsCoulomb& cou_settings, 
+    const IntegratorSettingsEXX& exx_settings ) {
+    return eval_coulomb_exx_(P,cou_settings,exx_settings);
+  }
+
   /** Get internal timers
    *
    *  @returns Timer instance for internal timings
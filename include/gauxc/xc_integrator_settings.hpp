@@ -6,6 +6,7 @@
  * See LICENSE.txt for details
  */
 #pragma once
+#include <gauxc/enums.hpp>
 
 namespace GauXC {
 
@@ -14,11 +15,52 @@ struct IntegratorSettingsSNLinK : public IntegratorSettingsEXX {
   bool screen_ek = true;
   double energy_tol = 1e-10;
   double k_tol      = 1e-10;
+
+  // Far-field multipole approximation of shell pair integrals (0 disables)
+  double multipole_tol = 0.;
+
+  // Shell pair integral engine for the G matrix (Auto selects per class)
+  ShellPairIntegralEngine integral_engine = ShellPairIntegralEngine::Auto;
+
+  // Dynamic load balancing of the sn-LinK tasks across MPI ranks as for
+  // IntegratorSettingsKS, the measured costs of stolen tasks are returned
+  // to the owning rank
+  bool inter_rank_work_stealing = false;
+
+  // Range-separated exchange operator (alpha + beta * erf(omega*r)) / r,
+  // e.g. alpha = 0, beta = 1 for long-range and alpha = 1, beta = -1 for
+  // short-range exchange (omega = 0 gives alpha / r)
+  double omega = 0.;
+  double alpha = 1.;
+  double beta  = 0.;
+};
+
+struct IntegratorSettingsCoulomb { virtual ~IntegratorSettingsCoulomb() noexcept = default; };
+struct IntegratorSettingsSNJ : public IntegratorSettingsCoulomb {
+  double j_tol = 1e-10;
+
+  // Far-field multipole approximation of shell pair integrals (0 disables)
+  double multipole_tol = 0.;
 };
 
 struct IntegratorSettingsXC { virtual ~IntegratorSettingsXC() noexcept = default; };
 struct IntegratorSettingsKS : public IntegratorSettingsXC {
   double gks_dtol = 1e-12;
+
+  // Task processing order, space filling curve orderings walk spatially
+  // coherent tasks on each thread
+  TaskOrdering task_ordering = TaskOrdering::Size;
+
+  // Dynamic load balancing of the local work across MPI ranks: ranks which
+  // run out of local tasks take unstarted tasks of other ranks through
+  // MPI one-sided operations (host integrators, no effect without MPI)
+  bool inter_rank_work_stealing = false;
+
+  // Include the derivatives of the Becke / SSF partition weights and the
+  // motion of the quadrature points along with their parent atoms in the
+  // XC gradient (host integrators), which makes the gradient accurate on
+  // smaller grids
+  bool weight_derivatives = false;
 };
 
 }
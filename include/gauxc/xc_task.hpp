@@ -27,6 +27,7 @@ struct XCTask {
 
   double                               dist_nearest;
   double                               max_weight = std::numeric_limits<double>::infinity();
+  double                               cost_exx_measured = 0.; // Wall time (s) of the last EXX evaluation
 
   struct screening_data {
     using pair_t = std::pair<int32_t,int32_t>;
@@ -42,6 +43,24 @@ struct XCTask {
         shell_pair_list == other.shell_pair_list;
     }
 
+    /// 64-bit hash of the shell (pair) lists chained onto seed, screening
+    /// data which are equiv_with each other have equal fingerprints
+    uint64_t fingerprint( uint64_t seed = 0 ) const {
+      auto mix = []( uint64_t h, uint64_t v ) {
+        // splitmix64 finalizer
+        uint64_t x = h ^ (v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2));
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+        return x ^ (x >> 31);
+      };
+      uint64_t h = mix( seed, shell_list.size() );
+      for( auto sh : shell_list ) h = mix( h, uint32_t(sh) );
+      h = mix( h, shell_pair_list.size() );
+      for( const auto& [i,j] : shell_pair_list ) 
+        h = mix( h, (uint64_t(uint32_t(i)) << 32) | uint32_t(j) );
+      return h;
+    }
+
     inline size_t volume() const {
       return (shell_list.size() + 2*shell_pair_list.size() + submat_block.size() +
               3*submat_map.size() + 1) * sizeof(int32_t);
@@ -50,7 +69,7 @@ struct XCTask {
 
   inline size_t volume() const {
     return 2 * sizeof(int32_t) +
-      (3*points.size() + weights.size() + 2) * sizeof(double) +
+      (3*points.size() + weights.size() + 3) * sizeof(double) +
       bfn_screening.volume() + cou_screening.volume();
   }
 
@@ -97,6 +116,11 @@ struct XCTask {
       bfn_screening.equiv_with(other.bfn_screening);
   }
 
+  /// Fingerprint of the data compared in equiv_with
+  inline uint64_t fingerprint() const {
+    return bfn_screening.fingerprint( uint32_t(iParent) );
+  }
+
   template <typename Archive>
   void serialize( Archive& ar ) {
     ar( iParent, bfn_screening.nbe, npts, dist_nearest, max_weight, 
@@ -12,6 +12,54 @@ namespace GauXC {
 
 using namespace HighFive;
 
+namespace {
+
+// Leading dimension of a dataset of loc
+hsize_t read_hdf5_extent( hid_t loc, const char* name ) {
+
+  auto d_id = H5Dopen( loc, name, H5P_DEFAULT );
+  if( d_id < 0 ) GAUXC_GENERIC_EXCEPTION("Dataset Open Failed");
+
+  auto space_id = H5Dget_space( d_id );
+  if( space_id < 0 ) GAUXC_GENERIC_EXCEPTION( "Space Retreival failed" );
+
+  hsize_t dims[2] = { 0, 0 };
+  H5Sget_simple_extent_dims( space_id, dims, NULL );
+
+  H5Dclose( d_id );
+  H5Sclose( space_id );
+
+  return dims[0];
+
+}
+
+// Read a dataset of loc into a contiguous n x ncol array of type, n is 
+// checked against the dataset extent
+void read_hdf5_array( hid_t loc, const char* name, hid_t type, hsize_t n,
+  hsize_t ncol, void* data ) {
+
+  auto d_id = H5Dopen( loc, name, H5P_DEFAULT );
+  if( d_id < 0 ) GAUXC_GENERIC_EXCEPTION("Dataset Open Failed");
+
+  auto space_id = H5Dget_space( d_id );
+  if( space_id < 0 ) GAUXC_GENERIC_EXCEPTION( "Space Retreival failed" );
+
+  hsize_t dims[2] = { 0, 1 };
+  auto ndims = H5Sget_simple_extent_ndims( space_id );
+  if( ndims != (ncol > 1 ? 2 : 1) ) 
+    GAUXC_GENERIC_EXCEPTION("Dataset Rank Mismatch");
+  H5Sget_simple_extent_dims( space_id, dims, NULL );
+  if( dims[0] != n or dims[1] != ncol ) 
+    GAUXC_GENERIC_EXCEPTION("Dataset Size Mismatch");
+
+  if( n ) H5Dread( d_id, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, data );
+
+  H5Dclose( d_id );
+  H5Sclose( space_id );
+
+}
+
+}
 
 void read_hdf5_record( std::vector<Shell<double>>& basis, std::string fname, 
   std::string dset ) {
@@ -83,6 +131,91 @@ void read_hdf5_record( std::vector<Atom>& mol, std::string fname, std::string ds
 }
 
 
+void read_hdf5_record( LoadBalancer& lb, std::string fname, std::string dset ) {
+
+  const auto& rt = lb.runtime();
+  File file( rank_file_name(fname, rt), File::ReadOnly );
+
+  auto g_id = H5Gopen( file.getId(), dset.c_str(), H5P_DEFAULT );
+  if( g_id < 0 ) GAUXC_GENERIC_EXCEPTION("Group Open Failed");
+
+  lb_state_t lb_state;
+  auto state_type = create_lb_state_type();
+  read_hdf5_array( g_id, "STATE", state_type, 1, 1, &lb_state );
+  H5Tclose( state_type );
+
+  if( lb_state.comm_size != rt.comm_size() )
+    GAUXC_GENERIC_EXCEPTION("LoadBalancer Record Written With Different Comm Size");
+  if( lb_state.natoms  != int32_t(lb.molecule().size()) or
+      lb_state.nshells != int32_t(lb.basis().size()) )
+    GAUXC_GENERIC_EXCEPTION("LoadBalancer Record Incompatible With Molecule / Basis");
+
+  // Task metadata
+  const auto ntasks = read_hdf5_extent( g_id, "TASKS" );
+  std::vector<xc_task_t> task_data( ntasks );
+  auto task_type = create_xc_task_type();
+  read_hdf5_array( g_id, "TASKS", task_type, ntasks, 1, task_data.data() );
+  H5Tclose( task_type );
+
+  size_t npts = 0, nshells = 0, nshells_prot = 0;
+  for( const auto& t : task_data ) {
+    npts         += t.npts;
+    nshells      += t.nshells;
+    nshells_prot += t.protonic_nshells;
+  }
+
+  std::vector<double>  points( 3*npts ), weights( npts );
+  std::vector<int32_t> shell_list( nshells ), protonic_shell_list( nshells_prot );
+  read_hdf5_array( g_id, "POINTS", H5T_NATIVE_DOUBLE, npts, 3, points.data() );
+  read_hdf5_array( g_id, "WEIGHTS", H5T_NATIVE_DOUBLE, npts, 1, weights.data() );
+  read_hdf5_array( g_id, "SHELL LIST", H5T_NATIVE_INT, nshells, 1, 
+    shell_list.data() );
+  read_hdf5_array( g_id, "PROTONIC SHELL LIST", H5T_NATIVE_INT, nshells_prot, 1, 
+    protonic_shell_list.data() );
+
+  H5Gclose( g_id );
+
+  // Unpack tasks
+  std::vector<XCTask> tasks( ntasks );
+  auto pts_it  = points.begin();
+  auto w_it    = weights.begin();
+  auto sh_it   = shell_list.begin();
+  auto psh_it  = protonic_shell_list.begin();
+  for( auto i = 0ul; i < ntasks; ++i ) {
+    const auto& t = task_data[i];
+    auto& task = tasks[i];
+
+    task.iParent           = t.iParent;
+    task.npts              = t.npts;
+    task.dist_nearest      = t.dist_nearest;
+    task.max_weight        = t.max_weight;
+    task.cost_exx_measured = t.cost_exx_measured;
+
+    task.points.resize( t.npts );
+    for( auto& pt : task.points ) {
+      std::copy_n( pts_it, 3, pt.begin() ); pts_it += 3;
+    }
+    task.weights.assign( w_it, w_it + t.npts ); w_it += t.npts;
+
+    task.bfn_screening.nbe = t.nbe;
+    task.bfn_screening.shell_list.assign( sh_it, sh_it + t.nshells );
+    sh_it += t.nshells;
+
+    task.protonic_bfn_screening.nbe = t.protonic_nbe;
+    task.protonic_bfn_screening.shell_list.assign( psh_it, 
+      psh_it + t.protonic_nshells );
+    psh_it += t.protonic_nshells;
+  }
+
+  lb.set_tasks( std::move(tasks) );
+  lb.state().modified_weights_are_stored = lb_state.modified_weights_are_stored;
+  lb.state().exx_costs_measured          = lb_state.exx_costs_measured;
+  lb.state().weight_alg                  = XCWeightAlg(lb_state.weight_alg);
+  lb.state().tasks_compacted             = lb_state.tasks_compacted;
+
+}
+
+
 void read_hdf5_record( int32_t M, int32_t N, double* A, int32_t LDA, 
   std::string fname, std::string dset ) {
 
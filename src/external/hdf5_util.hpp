@@ -10,6 +10,7 @@
 #include <highfive/H5File.hpp>
 #include <gauxc/shell.hpp>
 #include <gauxc/atom.hpp>
+#include <gauxc/load_balancer.hpp>
 
 namespace GauXC {
 
@@ -50,4 +51,65 @@ inline hid_t create_atom_type() {
 
 }
 
+
+struct xc_task_t {
+  int32_t iParent, npts, nbe, nshells, protonic_nbe, protonic_nshells;
+  double  dist_nearest, max_weight, cost_exx_measured;
+};
+
+inline hid_t create_xc_task_type() {
+
+  auto task_type = H5Tcreate( H5T_COMPOUND, sizeof(xc_task_t) );
+  H5Tinsert( task_type, "PARENT",  HOFFSET( xc_task_t, iParent ), H5T_NATIVE_INT );
+  H5Tinsert( task_type, "NPTS",    HOFFSET( xc_task_t, npts ),    H5T_NATIVE_INT );
+  H5Tinsert( task_type, "NBE",     HOFFSET( xc_task_t, nbe ),     H5T_NATIVE_INT );
+  H5Tinsert( task_type, "NSHELLS", HOFFSET( xc_task_t, nshells ), H5T_NATIVE_INT );
+  H5Tinsert( task_type, "PROTONIC NBE",     HOFFSET( xc_task_t, protonic_nbe ),     
+    H5T_NATIVE_INT );
+  H5Tinsert( task_type, "PROTONIC NSHELLS", HOFFSET( xc_task_t, protonic_nshells ), 
+    H5T_NATIVE_INT );
+  H5Tinsert( task_type, "DIST NEAREST", HOFFSET( xc_task_t, dist_nearest ), 
+    H5T_NATIVE_DOUBLE );
+  H5Tinsert( task_type, "MAX WEIGHT",   HOFFSET( xc_task_t, max_weight ),   
+    H5T_NATIVE_DOUBLE );
+  H5Tinsert( task_type, "COST EXX",     HOFFSET( xc_task_t, cost_exx_measured ),
+    H5T_NATIVE_DOUBLE );
+
+  return task_type;
+
+}
+
+
+struct lb_state_t {
+  int32_t modified_weights_are_stored, exx_costs_measured, weight_alg;
+  int32_t tasks_compacted;
+  int32_t comm_size, natoms, nshells;
+};
+
+inline hid_t create_lb_state_type() {
+
+  auto state_type = H5Tcreate( H5T_COMPOUND, sizeof(lb_state_t) );
+  H5Tinsert( state_type, "MODIFIED WEIGHTS", 
+    HOFFSET( lb_state_t, modified_weights_are_stored ), H5T_NATIVE_INT );
+  H5Tinsert( state_type, "EXX COSTS MEASURED", 
+    HOFFSET( lb_state_t, exx_costs_measured ), H5T_NATIVE_INT );
+  H5Tinsert( state_type, "WEIGHT ALG", 
+    HOFFSET( lb_state_t, weight_alg ), H5T_NATIVE_INT );
+  H5Tinsert( state_type, "TASKS COMPACTED", 
+    HOFFSET( lb_state_t, tasks_compacted ), H5T_NATIVE_INT );
+  H5Tinsert( state_type, "COMM SIZE", HOFFSET( lb_state_t, comm_size ), H5T_NATIVE_INT );
+  H5Tinsert( state_type, "NATOMS",    HOFFSET( lb_state_t, natoms ),    H5T_NATIVE_INT );
+  H5Tinsert( state_type, "NSHELLS",   HOFFSET( lb_state_t, nshells ),   H5T_NATIVE_INT );
+
+  return state_type;
+
+}
+
+/// File holding the LoadBalancer record of the calling rank
+inline std::string rank_file_name( const std::string& fname, 
+  const RuntimeEnvironment& rt ) {
+  if( rt.comm_size() == 1 ) return fname;
+  return fname + "." + std::to_string( rt.comm_rank() );
+}
+
 }
@@ -12,6 +12,27 @@ namespace GauXC {
 
 using namespace HighFive;
 
+namespace {
+
+// Write a contiguous n x ncol array of type to a new dataset of loc
+void write_hdf5_array( hid_t loc, const char* name, hid_t type, hsize_t n,
+  hsize_t ncol, const void* data ) {
+
+  hsize_t dims[2] = { n, ncol };
+  auto space_id = H5Screate_simple( ncol > 1 ? 2 : 1, dims, NULL );
+  auto d_id = H5Dcreate( loc, name, type, space_id, H5P_DEFAULT, H5P_DEFAULT,
+    H5P_DEFAULT );
+
+  if( d_id < 0 ) GAUXC_GENERIC_EXCEPTION("Dataset Creation Failed");
+
+  if( n ) H5Dwrite( d_id, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, data );
+
+  H5Dclose( d_id );
+  H5Sclose( space_id );
+
+}
+
+}
 
 void write_hdf5_record( const std::vector<Shell<double>>& basis, std::string fname, 
   std::string dset ) {
@@ -69,4 +90,77 @@ void write_hdf5_record( const std::vector<Atom>& mol, std::string fname, std::st
 }
 
 
+
+
+
+void write_hdf5_record( LoadBalancer& lb, std::string fname, std::string dset ) {
+
+  const auto& tasks = lb.get_tasks();
+  const auto& state = lb.state();
+  const auto& rt    = lb.runtime();
+
+  File file( rank_file_name(fname, rt), File::OpenOrCreate );
+
+  auto g_id = H5Gcreate( file.getId(), dset.c_str(), H5P_DEFAULT, H5P_DEFAULT,
+    H5P_DEFAULT );
+  if( g_id < 0 ) GAUXC_GENERIC_EXCEPTION("Group Creation Failed");
+
+  // LoadBalancerState + the data needed to validate the restart
+  lb_state_t lb_state{ state.modified_weights_are_stored, 
+    state.exx_costs_measured, int32_t(state.weight_alg), 
+    state.tasks_compacted, rt.comm_size(), int32_t(lb.molecule().size()),
+    int32_t(lb.basis().size()) };
+
+  auto state_type = create_lb_state_type();
+  write_hdf5_array( g_id, "STATE", state_type, 1, 1, &lb_state );
+  H5Tclose( state_type );
+
+  // Per-task metadata, the variable length task data is concatenated 
+  // in task order
+  std::vector<xc_task_t> task_data; task_data.reserve( tasks.size() );
+  std::vector<double>    points, weights;
+  std::vector<int32_t>   shell_list, protonic_shell_list;
+  for( const auto& task : tasks ) {
+
+    if( task.weights.size() != task.points.size() )
+      GAUXC_GENERIC_EXCEPTION("Task Points / Weights Size Mismatch");
+
+    const auto& bfn_scr  = task.bfn_screening;
+    const auto& prot_scr = task.protonic_bfn_screening;
+    task_data.push_back(
+      xc_task_t{
+        task.iParent, int32_t(task.points.size()), 
+        bfn_scr.nbe,  int32_t(bfn_scr.shell_list.size()),
+        prot_scr.nbe, int32_t(prot_scr.shell_list.size()),
+        task.dist_nearest, task.max_weight, task.cost_exx_measured
+      });
+
+    for( const auto& pt : task.points )
+      points.insert( points.end(), pt.begin(), pt.end() );
+    weights.insert( weights.end(), task.weights.begin(), task.weights.end() );
+    shell_list.insert( shell_list.end(), bfn_scr.shell_list.begin(),
+      bfn_scr.shell_list.end() );
+    protonic_shell_list.insert( protonic_shell_list.end(), 
+      prot_scr.shell_list.begin(), prot_scr.shell_list.end() );
+
+  }
+
+  auto task_type = create_xc_task_type();
+  write_hdf5_array( g_id, "TASKS", task_type, task_data.size(), 1, 
+    task_data.data() );
+  H5Tclose( task_type );
+
+  write_hdf5_array( g_id, "POINTS", H5T_NATIVE_DOUBLE, weights.size(), 3,
+    points.data() );
+  write_hdf5_array( g_id, "WEIGHTS", H5T_NATIVE_DOUBLE, weights.size(), 1,
+    weights.data() );
+  write_hdf5_array( g_id, "SHELL LIST", H5T_NATIVE_INT, shell_list.size(), 1,
+    shell_list.data() );
+  write_hdf5_array( g_id, "PROTONIC SHELL LIST", H5T_NATIVE_INT, 
+    protonic_shell_list.size(), 1, protonic_shell_list.data() );
+
+  H5Gclose( g_id );
+
+}
+
 }
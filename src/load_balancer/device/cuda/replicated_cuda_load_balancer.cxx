@@ -6,6 +6,7 @@
  * See LICENSE.txt for details
  */
 #include "replicated_cuda_load_balancer.hpp"
+#include "task_grouping.hpp"
 #include <gauxc/util/div_ceil.hpp>
 #include "device_specific/cuda_util.hpp"
 
@@ -245,6 +246,17 @@ std::vector< XCTask > DeviceReplicatedLoadBalancer::create_local_tasks_() const
 
   }
   
+  // Group equivalent tasks through their fingerprints
+  auto groups = group_equivalent_tasks( local_work.begin(), local_work.end(),
+    []( const auto& t ) { return t.fingerprint(); },
+    []( const auto& a, const auto& b ) { return a.equiv_with(b); } );
+
+  // Merge tasks
+  std::vector< XCTask > local_work_unique( groups.size() );
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t i = 0; i < groups.size(); ++i )
+    local_work_unique[i] = merge_task_group( local_work, groups[i] );
+
   // Lexicographic ordering of tasks
   auto task_order = []( const auto& a, const auto& b ) {
 
@@ -257,51 +269,9 @@ std::vector< XCTask > DeviceReplicatedLoadBalancer::create_local_tasks_() const
 
   };
 
-  std::sort( local_work.begin(), local_work.end(),
+  std::sort( local_work_unique.begin(), local_work_unique.end(),
     task_order ); 
 
-
-  // Get unique tasks
-  auto task_equiv = []( const auto& a, const auto& b ) {
-    return a.equiv_with(b);
-  };
-
-  auto local_work_unique = local_work;
-  auto last_unique = 
-    std::unique( local_work_unique.begin(),
-                 local_work_unique.end(),
-                 task_equiv );
-  local_work_unique.erase( last_unique, local_work_unique.end() );
-  
-
-  // Merge tasks
-  for( auto&& t : local_work_unique ) {
-    t.points.clear();
-    t.weights.clear();
-  }
-
-  auto cur_lw_begin = local_work.begin();
-  auto cur_uniq_it  = local_work_unique.begin();
-
-  for( auto lw_it = local_work.begin(); lw_it != local_work.end(); ++lw_it ) 
-  if( not task_equiv( *lw_it, *cur_uniq_it ) ) {
-
-    if( cur_uniq_it == local_work_unique.end() )
-      GAUXC_GENERIC_EXCEPTION("Messed up in unique");
-
-    cur_uniq_it->merge_with( cur_lw_begin, lw_it );
-
-    cur_lw_begin = lw_it;
-    cur_uniq_it++;
-
-  }
-
-  // Merge the last set of batches
-  for( ; cur_lw_begin != local_work.end(); ++cur_lw_begin )
-    cur_uniq_it->merge_with( *cur_lw_begin );
-  cur_uniq_it++;
-  
-
   local_work = std::move(local_work_unique);
   
   // Free all device memory
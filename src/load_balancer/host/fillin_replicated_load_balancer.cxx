@@ -6,7 +6,6 @@
  * See LICENSE.txt for details
  */
 #include "fillin_replicated_load_balancer.hpp"
-#include <gauxc/util/geometry.hpp>
 
 namespace GauXC  {
 namespace detail {
@@ -26,31 +25,20 @@ std::unique_ptr<LoadBalancerImpl> FillInHostReplicatedLoadBalancer::clone() cons
 
 std::pair<std::vector<int32_t>,size_t> FillInHostReplicatedLoadBalancer::micro_batch_screen(
   const BasisSet<double>&      bs,
+  const ShellSpatialIndex&     shell_index,
   const std::array<double,3>&  box_lo,
   const std::array<double,3>&  box_up
 ) const {
 
 
-  int32_t first_shell = -1;
-  int32_t last_shell  = -1;
-  for(auto iSh = 0ul; iSh < bs.size(); ++iSh) {
-
-    const auto& center = bs[iSh].O();
-    const auto  crad   = bs[iSh].cutoff_radius();
-    const bool intersect = 
-      geometry::cube_sphere_intersect( box_lo, box_up, center, crad );
-    
-    if( intersect ) {
-      if( first_shell < 0 ) first_shell = iSh;
-      last_shell = iSh;
-    }
-
-  }
-
-  if( first_shell < 0 ) {
+  const auto intersect = shell_index.query( box_lo, box_up );
+  if( intersect.empty() ) {
     return std::pair( std::vector<int32_t>{}, 0ul );
   }
 
+  const int32_t first_shell = intersect.front();
+  const int32_t last_shell  = intersect.back();
+
   int32_t nshells = last_shell - first_shell + 1;
   std::vector<int32_t> shell_list(nshells);
   std::iota( shell_list.begin(), shell_list.end(), first_shell );
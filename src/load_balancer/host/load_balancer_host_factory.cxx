@@ -23,6 +23,12 @@ std::shared_ptr<LoadBalancer> LoadBalancerHostFactory::get_shared_instance(
 
   if( kernel_name == "DEFAULT" or kernel_name == "REPLICATED" ) 
     kernel_name = "REPLICATED-PETITE";
+  if( kernel_name == "DISTRIBUTED" ) 
+    kernel_name = "DISTRIBUTED-PETITE";
+
+  // Distributed task generation yields the tasks of the replicated kernels
+  const bool distributed = kernel_name.rfind("DISTRIBUTED-", 0) == 0;
+  if( distributed ) kernel_name.replace(0, 11, "REPLICATED");
 
   std::unique_ptr<detail::LoadBalancerImpl> ptr = nullptr;
   if( kernel_name == "REPLICATED-PETITE" )
@@ -36,6 +42,8 @@ std::shared_ptr<LoadBalancer> LoadBalancerHostFactory::get_shared_instance(
     );
 
   if( ! ptr ) GAUXC_GENERIC_EXCEPTION("Load Balancer Kernel Not Recognized: " + kernel_name);
+  static_cast<detail::HostReplicatedLoadBalancer*>(ptr.get())->
+    set_distributed_generation( distributed );
 
   return std::make_shared<LoadBalancer>(std::move(ptr));
 
@@ -53,6 +61,12 @@ std::shared_ptr<LoadBalancer> LoadBalancerHostFactory::get_shared_instance(
 
   if( kernel_name == "DEFAULT" or kernel_name == "REPLICATED" ) 
     kernel_name = "REPLICATED-PETITE";
+  if( kernel_name == "DISTRIBUTED" ) 
+    kernel_name = "DISTRIBUTED-PETITE";
+
+  // Distributed task generation yields the tasks of the replicated kernels
+  const bool distributed = kernel_name.rfind("DISTRIBUTED-", 0) == 0;
+  if( distributed ) kernel_name.replace(0, 11, "REPLICATED");
 
   std::unique_ptr<detail::LoadBalancerImpl> ptr = nullptr;
   if( kernel_name == "REPLICATED-PETITE" )
@@ -66,6 +80,8 @@ std::shared_ptr<LoadBalancer> LoadBalancerHostFactory::get_shared_instance(
     );
 
   if( ! ptr ) GAUXC_GENERIC_EXCEPTION("Load Balancer Kernel Not Recognized: " + kernel_name);
+  static_cast<detail::HostReplicatedLoadBalancer*>(ptr.get())->
+    set_distributed_generation( distributed );
 
   return std::make_shared<LoadBalancer>(std::move(ptr));
 
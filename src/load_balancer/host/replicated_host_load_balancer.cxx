@@ -6,6 +6,10 @@
  * See LICENSE.txt for details
  */
 #include "replicated_host_load_balancer.hpp"
+#include "task_grouping.hpp"
+#include <gauxc/util/mpi.hpp>
+#include <unordered_map>
+#include <cmath>
 
 namespace GauXC {
 namespace detail {
@@ -15,7 +19,70 @@ HostReplicatedLoadBalancer::HostReplicatedLoadBalancer( HostReplicatedLoadBalanc
 
 HostReplicatedLoadBalancer::~HostReplicatedLoadBalancer() noexcept = default;
 
-std::vector< XCTask > HostReplicatedLoadBalancer::create_local_tasks_() const  {
+bool HostReplicatedLoadBalancer::generate_task_( batcher_type& batcher,
+  size_t ibatch, int32_t iAtom, const ShellSpatialIndex& shell_index,
+  const ShellSpatialIndex& protonic_shell_index, XCTask& task ) const {
+
+  // Generate the batch (non-negligible cost)
+  auto [lo, up, points, weights] = batcher.at(ibatch);
+
+  if( points.size() == 0 ) return false;
+
+  // Microbatch Screening
+  auto [shell_list, nbe] = micro_batch_screen( (*this->basis_), shell_index, lo, up );
+
+  // If there's a NEO protonic basis, then do microbatch screening on it
+  std::vector<int32_t> protonic_shell_list;
+  size_t protonic_nbe = 0;
+  if (this->protonic_basis_) 
+    std::tie(protonic_shell_list, protonic_nbe) = micro_batch_screen((*this->protonic_basis_), 
+      protonic_shell_index, lo, up);
+
+  // Course grain screening
+  // For NEO, skip task when electronic shell list is empty 
+  // (Protonic system doesnt have XC. It only has EPC)
+  if( not shell_list.size() ) return false; 
+
+  // Copy task data
+  task.iParent    = iAtom;
+  // This enables lazy assignment of points vector (see CUDA impl)
+  task.npts       = points.size(); 
+  task.points     = std::move( points );
+  task.weights    = std::move( weights );
+  task.bfn_screening.shell_list = std::move(shell_list);
+  task.bfn_screening.nbe        = nbe;
+  task.dist_nearest = molmeta_->dist_nearest()[iAtom];
+  if(this->protonic_basis_){
+    task.protonic_bfn_screening.shell_list = std::move(protonic_shell_list);
+    task.protonic_bfn_screening.nbe        = protonic_nbe;
+  }
+
+  return true;
+}
+
+void HostReplicatedLoadBalancer::screen_task_( XCTask& task, 
+  const std::array<double,3>& lo, const std::array<double,3>& up,
+  const ShellSpatialIndex& shell_index, 
+  const ShellSpatialIndex& protonic_shell_index ) const {
+
+  auto [shell_list, nbe] = micro_batch_screen( *basis_, shell_index, lo, up );
+
+  task.bfn_screening = XCTask::screening_data();
+  task.cou_screening = XCTask::screening_data();
+  task.bfn_screening.shell_list = std::move(shell_list);
+  task.bfn_screening.nbe        = nbe;
+
+  if( protonic_basis_ ) {
+    auto [protonic_shell_list, protonic_nbe] = 
+      micro_batch_screen( *protonic_basis_, protonic_shell_index, lo, up );
+    task.protonic_bfn_screening = XCTask::screening_data();
+    task.protonic_bfn_screening.shell_list = std::move(protonic_shell_list);
+    task.protonic_bfn_screening.nbe        = protonic_nbe;
+  }
+
+}
+
+std::vector< XCTask > HostReplicatedLoadBalancer::create_local_tasks_replicated_() const  {
 
   const int32_t n_deriv = 1; // Effects cost heuristic
 
@@ -36,6 +103,12 @@ std::vector< XCTask > HostReplicatedLoadBalancer::create_local_tasks_() const  {
   // For batching of multiple atom screening
   size_t batch_idx_offset = 0;
 
+  // Spatial indices for micro batch screening
+  const ShellSpatialIndex shell_index( *this->basis_ );
+  ShellSpatialIndex protonic_shell_index;
+  if( this->protonic_basis_ ) 
+    protonic_shell_index = ShellSpatialIndex( *this->protonic_basis_ );
+
   // Loop over Atoms
   for( const auto& atom : *this->mol_ ) {
 
@@ -50,39 +123,9 @@ std::vector< XCTask > HostReplicatedLoadBalancer::create_local_tasks_() const  {
     
       size_t batch_idx = ibatch + batch_idx_offset;
 
-      // Generate the batch (non-negligible cost)
-      auto [lo, up, points, weights] = batcher.at(ibatch);
-
-      if( points.size() == 0 ) continue;
-
-      // Microbatch Screening
-      auto [shell_list, nbe] = micro_batch_screen( (*this->basis_), lo, up );
-
-      // If there's a NEO protonic basis, then do microbatch screening on it
-      std::vector<int32_t> protonic_shell_list;
-      size_t protonic_nbe = 0;
-      if (this->protonic_basis_) 
-        std::tie(protonic_shell_list, protonic_nbe) = micro_batch_screen((*this->protonic_basis_), lo, up);
-
-      // Course grain screening
-      // For NEO, skip task when electronic shell list is empty 
-      // (Protonic system doesnt have XC. It only has EPC)
-      if( not shell_list.size() ) continue; 
-
-      // Copy task data
       XCTask task;
-      task.iParent    = iCurrent;
-      // This enables lazy assignment of points vector (see CUDA impl)
-      task.npts       = points.size(); 
-      task.points     = std::move( points );
-      task.weights    = std::move( weights );
-      task.bfn_screening.shell_list = std::move(shell_list);
-      task.bfn_screening.nbe        = nbe;
-      task.dist_nearest = molmeta_->dist_nearest()[iCurrent];
-      if(this->protonic_basis_){
-        task.protonic_bfn_screening.shell_list = std::move(protonic_shell_list);
-        task.protonic_bfn_screening.nbe        = protonic_nbe;
-      }
+      if( not generate_task_( batcher, ibatch, iCurrent, shell_index,
+        protonic_shell_index, task ) ) continue;
 
       #pragma omp critical
       temp_tasks.push_back( 
@@ -92,9 +135,6 @@ std::vector< XCTask > HostReplicatedLoadBalancer::create_local_tasks_() const  {
     } // omp parallel for over batches
 
 
-
-
-
     // Assign Tasks to MPI ranks
     if( (iCurrent+1) % atBatchSz == 0 or iCurrent == ((int32_t)natoms-1) ) {
 
@@ -135,8 +175,148 @@ std::vector< XCTask > HostReplicatedLoadBalancer::create_local_tasks_() const  {
 
   } // Loop over Atoms
 
+  return local_work;
+}
+
+std::vector< XCTask > HostReplicatedLoadBalancer::create_local_tasks_distributed_() const  {
+
+  std::vector< XCTask > local_work;
+
+#ifdef GAUXC_HAS_MPI
+  const int32_t n_deriv = 1; // Effects cost heuristic
+
+  int32_t world_rank = runtime_.comm_rank();
+  int32_t world_size = runtime_.comm_size();
+  auto comm = runtime_.comm();
+
+  const auto natoms = this->mol_->natoms();
+
+  // Global batch offsets of each atom
+  std::vector<size_t> batch_idx_offset( natoms + 1, 0 );
+  {
+    int32_t iAtom = 0;
+    for( const auto& atom : *this->mol_ ) {
+      batch_idx_offset[iAtom+1] = batch_idx_offset[iAtom] + 
+        mg_->get_grid(atom.Z).batcher().nbatches();
+      iAtom++;
+    }
+  }
+  const size_t nbatches_total = batch_idx_offset.back();
+
+  // Spatial indices for micro batch screening
+  const ShellSpatialIndex shell_index( *this->basis_ );
+  ShellSpatialIndex protonic_shell_index;
+  if( this->protonic_basis_ ) 
+    protonic_shell_index = ShellSpatialIndex( *this->protonic_basis_ );
+
+  // Generate and screen the batches in (global_idx, selector) on this rank
+  std::vector< std::pair<size_t, XCTask> > temp_tasks;
+  auto generate_batches = [&]( const auto& selector ) {
+    int32_t iAtom = 0;
+    for( const auto& atom : *this->mol_ ) {
+
+      const std::array<double,3> center = { atom.x, atom.y, atom.z };
+
+      auto& batcher = mg_->get_grid(atom.Z).batcher();
+      batcher.quadrature().recenter( center );
+      const size_t nbatches = batcher.nbatches();
+
+      #pragma omp parallel for
+      for( size_t ibatch = 0; ibatch < nbatches; ++ibatch ) {
+
+        size_t batch_idx = ibatch + batch_idx_offset[iAtom];
+        if( not selector(batch_idx) ) continue;
+
+        XCTask task;
+        if( not generate_task_( batcher, ibatch, iAtom, shell_index,
+          protonic_shell_index, task ) ) continue;
+
+        #pragma omp critical
+        temp_tasks.push_back( 
+          std::pair(batch_idx,std::move( task )) 
+        );
+
+      }
+
+      iAtom++;
+    }
+  };
+
+  // Generate a cyclic partition of the batches, negligible batches have 
+  // zero cost
+  generate_batches( [&]( size_t idx ){ return idx % world_size == size_t(world_rank); } );
+
+  std::vector<size_t> batch_cost_local( nbatches_total, 0 ), 
+                      batch_cost( nbatches_total, 0 );
+  for( const auto& [idx, task] : temp_tasks ) 
+    batch_cost_local[idx] = task.cost( n_deriv, natoms );
+
+  // Exchange the cost estimates
+  allreduce( batch_cost_local.data(), batch_cost.data(), nbatches_total, 
+    MPI_SUM, comm );
+
+  // Assign batches to MPI ranks (same assignment as the replicated 
+  // generation)
+  std::vector<size_t> global_workload( world_size, 0 );   
+  std::vector<int32_t> batch_rank( nbatches_total, -1 );
+  for( size_t idx = 0; idx < nbatches_total; ++idx ) 
+  if( batch_cost[idx] ) {
+
+    // Get rank with minimum work
+    auto min_rank_it = 
+      std::min_element( global_workload.begin(), global_workload.end() );
+    int64_t min_rank = std::distance( global_workload.begin(), min_rank_it );
+
+    global_workload[ min_rank ] += batch_cost[idx];
+    batch_rank[idx] = min_rank;
+
+  }
+
+  // Keep the locally generated batches assigned to this rank
+  temp_tasks.erase( std::remove_if( temp_tasks.begin(), temp_tasks.end(),
+    [&]( const auto& t ){ return batch_rank[t.first] != world_rank; } ),
+    temp_tasks.end() );
+
+  // Generate the remaining batches assigned to this rank
+  generate_batches( [&]( size_t idx ){ 
+    return batch_rank[idx] == world_rank and 
+      idx % world_size != size_t(world_rank);
+  });
+
+  // Sort based on task index for deterministic ordering
+  std::sort( temp_tasks.begin(), temp_tasks.end(), 
+    []( const auto& a, const auto& b ) {
+      return a.first < b.first;
+    } );
+
+  local_work.reserve( temp_tasks.size() );
+  for( auto& [idx, task] : temp_tasks ) local_work.emplace_back( std::move(task) );
+#endif
+
+  return local_work;
+}
+
+std::vector< XCTask > HostReplicatedLoadBalancer::create_local_tasks_() const  {
+
+  int32_t world_size = runtime_.comm_size();
+
+  std::vector< XCTask > local_work = 
+    (distributed_generation_ and world_size > 1) ?
+      create_local_tasks_distributed_() : create_local_tasks_replicated_();
+
 //return local_work;
 
+  // Group equivalent tasks through their fingerprints
+  auto groups = group_equivalent_tasks( local_work.begin(), local_work.end(),
+    []( const auto& t ) { return t.fingerprint(); },
+    []( const auto& a, const auto& b ) { return a.equiv_with(b); } );
+
+  // Merge tasks
+  std::vector< XCTask > local_work_unique( groups.size() );
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t i = 0; i < groups.size(); ++i )
+    local_work_unique[i] = merge_task_group( local_work, groups[i] );
+
   // Lexicographic ordering of tasks
   auto task_order = []( const auto& a, const auto& b ) {
 
@@ -149,62 +329,672 @@ std::vector< XCTask > HostReplicatedLoadBalancer::create_local_tasks_() const  {
 
   };
 
-  std::sort( local_work.begin(), local_work.end(),
+  std::sort( local_work_unique.begin(), local_work_unique.end(),
     task_order ); 
 
+  local_work = std::move(local_work_unique);
+
+  return local_work;
+}
+
+
+namespace {
 
-  // Get unique tasks
-  auto task_equiv = []( const auto& a, const auto& b ) {
-    return a.equiv_with(b);
+using point_type = std::array<double,3>;
+using box_type   = std::pair<point_type, point_type>;
+
+// Bounding box of a set of points
+box_type bounding_box( const std::vector<point_type>& points ) {
+  constexpr auto inf = std::numeric_limits<double>::infinity();
+  box_type box = { {inf, inf, inf}, {-inf, -inf, -inf} };
+  for( const auto& p : points )
+  for( int k = 0; k < 3; ++k ) {
+    box.first[k]  = std::min( box.first[k],  p[k] );
+    box.second[k] = std::max( box.second[k], p[k] );
+  }
+  return box;
+}
+
+// Lookup of points up to round off, on a grid of cells of size cell_length
+constexpr double cell_length = 1e-10;
+using cell_type = std::array<int64_t,3>;
+
+struct cell_hash {
+  size_t operator()( const cell_type& c ) const {
+    size_t h = 0;
+    for( auto x : c ) 
+      h ^= std::hash<int64_t>{}(x) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    return h;
+  }
+};
+
+cell_type point_cell( const point_type& p ) {
+  return { std::llround( p[0] / cell_length ), 
+           std::llround( p[1] / cell_length ),
+           std::llround( p[2] / cell_length ) };
+}
+
+// Index of the point in points within cell_length of p, points.size() if 
+// there is none
+size_t find_point( 
+  const std::unordered_map< cell_type, size_t, cell_hash >& cells, 
+  const std::vector<point_type>& points, const point_type& p ) {
+
+  const auto c = point_cell( p );
+  for( int64_t i = -1; i <= 1; ++i )
+  for( int64_t j = -1; j <= 1; ++j )
+  for( int64_t k = -1; k <= 1; ++k ) {
+    auto it = cells.find( { c[0] + i, c[1] + j, c[2] + k } );
+    if( it == cells.end() ) continue;
+    const auto& q = points[it->second];
+    if( std::abs(q[0] - p[0]) <= cell_length and 
+        std::abs(q[1] - p[1]) <= cell_length and
+        std::abs(q[2] - p[2]) <= cell_length ) return it->second;
+  }
+  return points.size();
+
+}
+
+bool box_empty( const box_type& box ) {
+  return box.first[0] > box.second[0];
+}
+
+// Translation of atom-relative boxes to the center of an atom
+auto shifted_box_fn( const Atom& atom ) {
+  return [c = std::array<double,3>{ atom.x, atom.y, atom.z }]( const box_type& box ) {
+    box_type shifted;
+    for( int k = 0; k < 3; ++k ) {
+      shifted.first[k]  = box.first[k]  + c[k];
+      shifted.second[k] = box.second[k] + c[k];
+    }
+    return shifted;
   };
+}
 
-  auto local_work_unique = local_work;
-  auto last_unique = 
-    std::unique( local_work_unique.begin(),
-                 local_work_unique.end(),
-                 task_equiv );
-  local_work_unique.erase( last_unique, local_work_unique.end() );
-  
+}
 
-  // Merge tasks
-  for( auto&& t : local_work_unique ) {
-    t.points.clear();
-    t.weights.clear();
-    t.npts = 0;
+void HostReplicatedLoadBalancer::merge_equivalent_tasks_() {
+
+  auto& tasks = local_tasks_;
+  auto groups = group_equivalent_tasks( tasks.begin(), tasks.end(),
+    []( const auto& t ) { return t.fingerprint(); },
+    []( const auto& a, const auto& b ) { return a.equiv_with(b); } );
+  if( groups.size() == tasks.size() ) return;
+
+  std::vector< XCTask > tasks_unique( groups.size() );
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t i = 0; i < groups.size(); ++i )
+    tasks_unique[i] = merge_task_group( tasks, groups[i] );
+  tasks = std::move(tasks_unique);
+
+}
+
+size_t HostReplicatedLoadBalancer::local_cost_() const {
+  const int32_t n_deriv = 1; // Effects cost heuristic
+  const size_t  natoms  = mol_->natoms();
+  size_t cost = 0;
+  for( const auto& task : local_tasks_ ) cost += task.cost( n_deriv, natoms );
+  return cost;
+}
+
+void HostReplicatedLoadBalancer::rebalance_on_drift_( size_t cost_old,
+  double rebalance_threshold ) {
+
+#ifdef GAUXC_HAS_MPI
+  // Keep the MPI assignment unless the cost estimates drifted
+  if( runtime_.comm_size() > 1 ) {
+    const size_t cost_new = local_cost_();
+    const double drift = cost_old ? 
+      std::abs( double(cost_new) - double(cost_old) ) / cost_old : 0.;
+    if( allreduce( drift, MPI_MAX, runtime_.comm() ) > rebalance_threshold ) 
+      rebalance_weights();
+  }
+#else
+  (void)cost_old; (void)rebalance_threshold;
+#endif
+
+}
+
+void HostReplicatedLoadBalancer::cache_batches_() {
+
+  const auto&  mol    = *mol_;
+  const size_t natoms = mol.natoms();
+  constexpr auto inf  = std::numeric_limits<double>::infinity();
+
+  // Batch boxes relative to the atomic center
+  for( const auto& atom : mol ) {
+    if( batch_boxes_.count( atom.Z ) ) continue;
+    auto& batcher = mg_->get_grid(atom.Z).batcher();
+    batcher.quadrature().recenter( {0., 0., 0.} );
+    const size_t nbatches = batcher.nbatches();
+    std::vector<box_type> boxes( nbatches );
+    #pragma omp parallel for
+    for( size_t ibatch = 0; ibatch < nbatches; ++ibatch ) {
+      auto [lo, up, points, weights] = batcher.at(ibatch);
+      boxes[ibatch] = points.size() ? box_type( lo, up ) :
+        box_type( {inf, inf, inf}, {-inf, -inf, -inf} );
+    }
+    batch_boxes_.emplace( atom.Z, std::move(boxes) );
   }
 
-  auto cur_lw_begin = local_work.begin();
-  auto cur_uniq_it  = local_work_unique.begin();
+  if( untracked_batches_.size() == natoms ) return;
 
-  for( auto lw_it = local_work.begin(); lw_it != local_work.end(); ++lw_it ) 
-  if( not task_equiv( *lw_it, *cur_uniq_it ) ) {
+  // Batches which were screened out at task generation
+  const ShellSpatialIndex shell_index( *basis_ );
+  untracked_batches_.resize( natoms );
+  for( size_t iAtom = 0; iAtom < natoms; ++iAtom ) {
+    const auto& boxes = batch_boxes_.at( mol[iAtom].Z );
+    const auto  box   = shifted_box_fn( mol[iAtom] );
+    auto& untracked = untracked_batches_[iAtom];
+    untracked.assign( boxes.size(), false );
+    #pragma omp parallel for
+    for( size_t ibatch = 0; ibatch < boxes.size(); ++ibatch ) 
+    if( not box_empty( boxes[ibatch] ) ) {
+      const auto [lo, up] = box( boxes[ibatch] );
+      untracked[ibatch] = shell_index.query( lo, up ).empty();
+    }
+  }
 
-    if( cur_uniq_it == local_work_unique.end() )
-      GAUXC_GENERIC_EXCEPTION("Messed up in unique");
+}
+
+bool HostReplicatedLoadBalancer::untracked_batches_significant_( 
+  const ShellSpatialIndex& shell_index ) {
+
+  const auto& mol = *mol_;
+  int significant = 0;
+  for( size_t iAtom = 0; iAtom < untracked_batches_.size(); ++iAtom ) {
+    const auto& boxes     = batch_boxes_.at( mol[iAtom].Z );
+    const auto& untracked = untracked_batches_[iAtom];
+    const auto  box       = shifted_box_fn( mol[iAtom] );
+    #pragma omp parallel for reduction(||:significant)
+    for( size_t ibatch = 0; ibatch < boxes.size(); ++ibatch ) 
+    if( untracked[ibatch] ) {
+      const auto [lo, up] = box( boxes[ibatch] );
+      if( shell_index.query( lo, up ).size() ) significant = true;
+    }
+  }
 
-    cur_uniq_it->merge_with( cur_lw_begin, lw_it );
+#ifdef GAUXC_HAS_MPI
+  // Dropped tasks are untracked on their rank only
+  if( runtime_.comm_size() > 1 )
+    significant = allreduce( significant, MPI_MAX, runtime_.comm() );
+#endif
 
-    cur_lw_begin = lw_it;
-    cur_uniq_it++;
+  return significant;
 
+}
+
+void HostReplicatedLoadBalancer::untrack_task_( const XCTask& task ) {
+
+  if( task.points.empty() ) return;
+  cache_batches_();
+
+  const auto& atom  = (*mol_)[task.iParent];
+  const auto& boxes = batch_boxes_.at( atom.Z );
+  const auto  box   = shifted_box_fn( atom );
+  const auto [t_lo, t_up] = bounding_box( task.points );
+
+  auto& untracked = untracked_batches_[task.iParent];
+  for( size_t ibatch = 0; ibatch < boxes.size(); ++ibatch ) 
+  if( not box_empty( boxes[ibatch] ) ) {
+    const auto [lo, up] = box( boxes[ibatch] );
+    bool overlap = true;
+    for( int k = 0; k < 3; ++k ) 
+      overlap = overlap and lo[k] <= t_up[k] and up[k] >= t_lo[k];
+    if( overlap ) untracked[ibatch] = true;
   }
 
-  // Merge the last set of batches
-  for( ; cur_lw_begin != local_work.end(); ++cur_lw_begin )
-    cur_uniq_it->merge_with( *cur_lw_begin );
-  cur_uniq_it++;
-  
+}
 
-  local_work = std::move(local_work_unique);
+void HostReplicatedLoadBalancer::drop_negligible_tasks_() {
+
+  auto negligible = []( const auto& t ) {
+    return t.points.empty() or t.bfn_screening.shell_list.empty();
+  };
+
+  auto& tasks = local_tasks_;
+  for( const auto& task : tasks ) 
+    if( negligible(task) ) untrack_task_( task );
+
+  tasks.erase( std::remove_if( tasks.begin(), tasks.end(), negligible ),
+    tasks.end() );
+
+}
+
+void HostReplicatedLoadBalancer::regenerate_tasks_() {
+
+  local_tasks_ = create_local_tasks_();
+  untracked_batches_.clear();
+  state_.modified_weights_are_stored = false;
+  state_.exx_costs_measured = false;
+  state_.tasks_compacted = false;
+
+}
+
+void HostReplicatedLoadBalancer::restore_quadrature_weights_() {
+
+  const auto&  mol    = *mol_;
+  const size_t natoms = mol.natoms();
+  auto& tasks = local_tasks_;
+
+  std::vector< std::vector<int32_t> > atom_tasks( natoms );
+  for( size_t iT = 0; iT < tasks.size(); ++iT ) 
+    atom_tasks[tasks[iT].iParent].emplace_back( iT );
+
+  for( size_t iAtom = 0; iAtom < natoms; ++iAtom ) {
+
+    if( atom_tasks[iAtom].empty() ) continue;
+
+    // Task points were translated with their atom, they match the 
+    // quadrature points (relative to the atom) up to round off
+    const auto& atom = mol[iAtom];
+    auto& quad = mg_->get_grid(atom.Z).batcher().quadrature();
+    quad.recenter( {0., 0., 0.} );
+    const auto& q_points  = quad.points();
+    const auto& q_weights = quad.weights();
+
+    std::unordered_map< cell_type, size_t, cell_hash > quad_cells;
+    for( size_t i = 0; i < q_points.size(); ++i )
+      quad_cells.emplace( point_cell( q_points[i] ), i );
+
+    size_t nmissing = 0;
+    for( auto iT : atom_tasks[iAtom] ) {
+      auto& task = tasks[iT];
+      for( size_t ipt = 0; ipt < task.points.size(); ++ipt ) {
+        const point_type r = { task.points[ipt][0] - atom.x,
+          task.points[ipt][1] - atom.y, task.points[ipt][2] - atom.z };
+        const auto i = find_point( quad_cells, q_points, r );
+        if( i < q_points.size() ) task.weights[ipt] = q_weights[i];
+        else nmissing++;
+      }
+    }
+
+    if( nmissing )
+      GAUXC_GENERIC_EXCEPTION("Task Points Not Found in Molecular Grid");
+
+  }
+
+}
+
+void HostReplicatedLoadBalancer::update_geometry( const Molecule& mol,
+  double rebalance_threshold ) {
+
+  const size_t natoms = mol_->natoms();
+  if( mol.natoms() != natoms ) 
+    GAUXC_GENERIC_EXCEPTION("Number of Atoms Changed in update_geometry");
+  for( size_t iAtom = 0; iAtom < natoms; ++iAtom )
+  if( mol[iAtom].Z != (*mol_)[iAtom].Z )
+    GAUXC_GENERIC_EXCEPTION("Atomic Numbers Changed in update_geometry");
+
+  const size_t cost_old = local_cost_();
+
+  // Batch data of the current geometry, the partitioned weights are 
+  // replaced by the (translation invariant) quadrature weights
+  if( tasks_generated_ and not state_.tasks_compacted ) {
+    cache_batches_();
+    if( state_.modified_weights_are_stored ) restore_quadrature_weights_();
+  }
+
+  // Move the basis centers with their atoms
+  auto move_basis = [&]( const basis_type& bs, const basis_map_type& bs_map ) {
+    auto moved_bs = std::make_shared<basis_type>( bs );
+    for( size_t ish = 0; ish < bs.size(); ++ish ) {
+      const auto iAtom = bs_map.shell_to_center(ish);
+      if( iAtom < 0 ) continue; // Not centered on an atom
+      (*moved_bs)[ish].O() = { mol[iAtom].x, mol[iAtom].y, mol[iAtom].z };
+    }
+    return moved_bs;
+  };
+
+  const auto old_mol = mol_;
+
+  mol_       = std::make_shared<Molecule>( mol );
+  molmeta_   = std::make_shared<MolMeta>( mol );
+  basis_     = move_basis( *basis_, *basis_map_ );
+  basis_map_ = std::make_shared<basis_map_type>( *basis_, mol );
+  if( protonic_basis_ ) {
+    protonic_basis_     = move_basis( *protonic_basis_, *protonic_basis_map_ );
+    protonic_basis_map_ = std::make_shared<basis_map_type>( *protonic_basis_, mol );
+  }
+  shell_pairs_ = nullptr; // Regenerated on demand
+  state_.modified_weights_are_stored = false;
+
+  // Tasks have not been generated yet (the same on every rank)
+  if( not tasks_generated_ ) return;
+
+  // Compaction removed points which are not negligible in general (e.g.
+  // for the new geometry / weights), regenerate the full quadrature
+  if( state_.tasks_compacted ) {
+    regenerate_tasks_();
+    return;
+  }
+
+  // Spatial indices for micro batch screening
+  const ShellSpatialIndex shell_index( *basis_ );
+  ShellSpatialIndex protonic_shell_index;
+  if( this->protonic_basis_ ) 
+    protonic_shell_index = ShellSpatialIndex( *this->protonic_basis_ );
+
+  // Batches which are in no task require the tasks to be regenerated once
+  // they become significant, the batch boxes translate with their atom
+  if( untracked_batches_significant_( shell_index ) ) {
+    regenerate_tasks_();
+    return;
+  }
+
+  // Translate the points rigidly with their parent atom and screen each 
+  // task against the bounding box of its points
+  auto& tasks = local_tasks_;
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t iT = 0; iT < tasks.size(); ++iT ) {
+
+    auto& task = tasks[iT];
+    const auto& old_atom = (*old_mol)[task.iParent];
+    const auto& atom     = mol[task.iParent];
+    const std::array<double,3> disp = { atom.x - old_atom.x,
+      atom.y - old_atom.y, atom.z - old_atom.z };
+    for( auto& pt : task.points )
+    for( int k = 0; k < 3; ++k ) pt[k] += disp[k];
+
+    const auto [lo, up] = bounding_box( task.points );
+    screen_task_( task, lo, up, shell_index, protonic_shell_index );
+    task.dist_nearest = molmeta_->dist_nearest()[task.iParent];
+
+  }
+
+  // Drop the tasks which became negligible, merge the tasks which became 
+  // equivalent
+  drop_negligible_tasks_();
+  merge_equivalent_tasks_();
+
+  rebalance_on_drift_( cost_old, rebalance_threshold );
 
-  return local_work;
 }
 
+void HostReplicatedLoadBalancer::update_basis( const basis_type& basis,
+  const basis_type* protonic_basis, double rebalance_threshold ) {
 
+  const size_t cost_old = local_cost_();
 
+  // Batches which are negligible for the current basis
+  if( tasks_generated_ ) cache_batches_();
 
+  basis_     = std::make_shared<basis_type>( basis );
+  basis_map_ = std::make_shared<basis_map_type>( *basis_, *mol_ );
+  if( protonic_basis ) {
+    protonic_basis_     = std::make_shared<basis_type>( *protonic_basis );
+    protonic_basis_map_ = std::make_shared<basis_map_type>( *protonic_basis_, 
+      *mol_ );
+  }
+  shell_pairs_ = nullptr; // Regenerated on demand
+
+  // Tasks have not been generated yet (the same on every rank)
+  if( not tasks_generated_ ) return;
+
+  // Spatial indices for micro batch screening
+  const ShellSpatialIndex shell_index( *basis_ );
+  ShellSpatialIndex protonic_shell_index;
+  if( this->protonic_basis_ ) 
+    protonic_shell_index = ShellSpatialIndex( *this->protonic_basis_ );
+
+  // The points of untracked batches are not part of any task, the tasks are
+  // regenerated if any of these batches is significant for the new basis
+  if( untracked_batches_significant_( shell_index ) ) {
+    regenerate_tasks_();
+    return;
+  }
+
+  // The grid is unchanged: screen each task against the bounding box of its
+  // points, the (compacted) points, (partitioned) weights and measured EXX
+  // costs are kept
+  auto& tasks = local_tasks_;
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t iT = 0; iT < tasks.size(); ++iT ) {
+    const auto [lo, up] = bounding_box( tasks[iT].points );
+    screen_task_( tasks[iT], lo, up, shell_index, protonic_shell_index );
+  }
+
+  // Drop the tasks which became negligible, merge the tasks which became 
+  // equivalent
+  drop_negligible_tasks_();
+  merge_equivalent_tasks_();
+
+  rebalance_on_drift_( cost_old, rebalance_threshold );
+
+}
 
+void HostReplicatedLoadBalancer::adapt_task_sizes( size_t min_cost, 
+  size_t max_cost, double max_nbe_growth ) {
+
+  if( min_cost > max_cost ) GAUXC_GENERIC_EXCEPTION("Invalid Task Cost Window");
+
+  const int32_t n_deriv = 1; // Effects cost heuristic
+  const size_t  natoms  = mol_->natoms();
+
+  auto& tasks = get_tasks();
+
+  // Spatial indices for micro batch screening
+  const ShellSpatialIndex shell_index( *basis_ );
+  ShellSpatialIndex protonic_shell_index;
+  if( this->protonic_basis_ ) 
+    protonic_shell_index = ShellSpatialIndex( *this->protonic_basis_ );
+
+  // Task carrying the metadata of a parent task and a subset of its points
+  auto sub_task = []( const XCTask& parent ) {
+    XCTask task;
+    task.iParent      = parent.iParent;
+    task.dist_nearest = parent.dist_nearest;
+    task.max_weight   = parent.max_weight;
+    return task;
+  };
+
+  // Split oversized tasks by recursive median bisection of their points
+  // along the longest extent
+  std::vector<XCTask> adapted; adapted.reserve( tasks.size() );
+  std::vector<XCTask> stack;
+  for( auto& task : tasks ) {
+
+    stack.emplace_back( std::move(task) );
+    while( not stack.empty() ) {
+
+      auto t = std::move(stack.back()); stack.pop_back();
+      const size_t npts = t.points.size();
+      if( t.cost(n_deriv, natoms) <= max_cost or npts < 2 ) {
+        adapted.emplace_back( std::move(t) );
+        continue;
+      }
+
+      const auto [lo, up] = bounding_box( t.points );
+      int axis = 0;
+      for( int k = 1; k < 3; ++k ) 
+        if( up[k] - lo[k] > up[axis] - lo[axis] ) axis = k;
+
+      std::vector<size_t> perm( npts );
+      std::iota( perm.begin(), perm.end(), 0 );
+      std::nth_element( perm.begin(), perm.begin() + npts/2, perm.end(),
+        [&]( auto i, auto j ){ return t.points[i][axis] < t.points[j][axis]; } );
+
+      for( auto [first, last] : { std::pair(0ul, npts/2), std::pair(npts/2, npts) } ) {
+        auto half = sub_task( t );
+        for( auto i = first; i < last; ++i ) {
+          half.points.emplace_back( t.points[perm[i]] );
+          half.weights.emplace_back( t.weights[perm[i]] );
+        }
+        half.npts = half.points.size();
+        half.cost_exx_measured = t.cost_exx_measured * half.npts / npts;
+
+        const auto [h_lo, h_up] = bounding_box( half.points );
+        screen_task_( half, h_lo, h_up, shell_index, protonic_shell_index );
+        if( half.bfn_screening.shell_list.size() ) 
+          stack.emplace_back( std::move(half) );
+        else untrack_task_( half );
+      }
+
+    }
+
+  }
 
+  // Merge undersized tasks with the nearby tasks of the same parent atom
+  // which yield the smallest merged nbe, within the bounded nbe growth
+  std::stable_sort( adapted.begin(), adapted.end(), 
+    []( const auto& a, const auto& b ){ return a.iParent < b.iParent; } );
+
+  constexpr size_t ncandidates = 4;
+  auto parent_begin = adapted.begin();
+  while( parent_begin != adapted.end() ) {
+
+    auto parent_end = std::find_if( parent_begin, adapted.end(), 
+      [&]( const auto& t ){ return t.iParent != parent_begin->iParent; } );
+
+    bool merged = true;
+    while( merged ) {
+
+      merged = false;
+      std::vector<size_t> small;
+      for( auto it = parent_begin; it != parent_end; ++it )
+        if( it->points.size() and it->cost(n_deriv, natoms) < min_cost ) 
+          small.emplace_back( std::distance(parent_begin, it) );
+      std::sort( small.begin(), small.end(), [&]( auto i, auto j ) {
+        return (parent_begin+i)->cost(n_deriv, natoms) < 
+               (parent_begin+j)->cost(n_deriv, natoms);
+      });
+
+      std::vector<box_type> boxes( small.size() );
+      for( size_t i = 0; i < small.size(); ++i ) 
+        boxes[i] = bounding_box( (parent_begin + small[i])->points );
+
+      std::vector<char> consumed( small.size(), false );
+      for( size_t i = 0; i < small.size(); ++i ) {
+
+        if( consumed[i] ) continue;
+        auto& a = *(parent_begin + small[i]);
+
+        // Nearest candidates by box center distance
+        auto center_dist = [&]( size_t j ) {
+          double d = 0.;
+          for( int k = 0; k < 3; ++k ) {
+            const double dk = 0.5 * (boxes[i].first[k] + boxes[i].second[k] - 
+              boxes[j].first[k] - boxes[j].second[k]);
+            d += dk * dk;
+          }
+          return d;
+        };
+        std::vector<size_t> cand;
+        for( size_t j = 0; j < small.size(); ++j )
+          if( j != i and not consumed[j] ) cand.emplace_back(j);
+        const auto ncand = std::min( ncandidates, cand.size() );
+        std::partial_sort( cand.begin(), cand.begin() + ncand, cand.end(),
+          [&]( auto x, auto y ){ return center_dist(x) < center_dist(y); } );
+
+        int64_t best = -1; size_t best_nbe = 0; box_type best_box;
+        for( size_t c = 0; c < ncand; ++c ) {
+          const auto j = cand[c];
+          const auto& b = *(parent_begin + small[j]);
+
+          box_type box;
+          for( int k = 0; k < 3; ++k ) {
+            box.first[k]  = std::min( boxes[i].first[k],  boxes[j].first[k] );
+            box.second[k] = std::max( boxes[i].second[k], boxes[j].second[k] );
+          }
+          const auto nbe = micro_batch_screen( *basis_, shell_index, 
+            box.first, box.second ).second;
+
+          const auto nbe_max = std::max( a.bfn_screening.nbe, b.bfn_screening.nbe );
+          XCTask merged_task;
+          merged_task.npts = a.points.size() + b.points.size();
+          merged_task.bfn_screening.nbe = nbe;
+          if( nbe > (1. + max_nbe_growth) * nbe_max or 
+              merged_task.cost(n_deriv, natoms) > max_cost ) continue;
+
+          if( best < 0 or nbe < best_nbe ) {
+            best = j; best_nbe = nbe; best_box = box;
+          }
+        }
+
+        if( best < 0 ) continue;
+
+        auto& b = *(parent_begin + small[best]);
+        a.points.insert( a.points.end(), b.points.begin(), b.points.end() );
+        a.weights.insert( a.weights.end(), b.weights.begin(), b.weights.end() );
+        a.npts = a.points.size();
+        a.cost_exx_measured += b.cost_exx_measured;
+        screen_task_( a, best_box.first, best_box.second, shell_index, 
+          protonic_shell_index );
+        b.points.clear(); b.weights.clear(); b.npts = 0;
+
+        boxes[i] = best_box;
+        consumed[best] = true;
+        merged = true;
+
+      }
+
+    }
+
+    parent_begin = parent_end;
+
+  }
+
+  // Remove the merged tasks
+  adapted.erase( std::remove_if( adapted.begin(), adapted.end(), 
+    []( const auto& t ){ return t.points.empty(); } ), adapted.end() );
+
+  tasks = std::move(adapted);
+
+}
+
+void HostReplicatedLoadBalancer::compact_tasks( double weight_tol,
+  double rebalance_threshold ) {
+
+  if( not state_.modified_weights_are_stored )
+    GAUXC_GENERIC_EXCEPTION("Task Compaction Requires Modified Weights");
+
+  const size_t cost_old = local_cost_();
+
+  // Spatial indices for micro batch screening
+  const ShellSpatialIndex shell_index( *basis_ );
+  ShellSpatialIndex protonic_shell_index;
+  if( this->protonic_basis_ ) 
+    protonic_shell_index = ShellSpatialIndex( *this->protonic_basis_ );
+
+  // Remove the negligible points, the tasks which lost points are screened
+  // against the (smaller) bounding box of the remaining ones
+  auto& tasks = get_tasks();
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t iT = 0; iT < tasks.size(); ++iT ) {
+
+    auto& task = tasks[iT];
+    const size_t npts = task.points.size();
+
+    size_t npts_keep = 0;
+    for( size_t ipt = 0; ipt < npts; ++ipt ) 
+    if( std::abs(task.weights[ipt]) > weight_tol ) {
+      task.points[npts_keep]  = task.points[ipt];
+      task.weights[npts_keep] = task.weights[ipt];
+      ++npts_keep;
+    }
+    if( npts_keep == npts ) continue;
+
+    task.points.resize( npts_keep );
+    task.weights.resize( npts_keep );
+    task.npts = npts_keep;
+    task.cost_exx_measured = task.cost_exx_measured * npts_keep / npts;
+    if( not npts_keep ) continue;
+
+    const auto [lo, up] = bounding_box( task.points );
+    screen_task_( task, lo, up, shell_index, protonic_shell_index );
+
+  }
+
+  // Drop the tasks which became empty or negligible
+  drop_negligible_tasks_();
+
+  // Merge the tasks which became equivalent
+  merge_equivalent_tasks_();
+  state_.tasks_compacted = true;
+
+  rebalance_on_drift_( cost_old, rebalance_threshold );
+
+}
 
 }
 }
@@ -8,6 +8,8 @@
 #pragma once
 
 #include "load_balancer_impl.hpp"
+#include "shell_spatial_index.hpp"
+#include <unordered_map>
 
 namespace GauXC  {
 namespace detail {
@@ -17,8 +19,72 @@ class HostReplicatedLoadBalancer : public LoadBalancerImpl {
 protected:
 
   using basis_type = BasisSet<double>;
+  using box_type   = std::pair< std::array<double,3>, std::array<double,3> >;
   std::vector< XCTask > create_local_tasks_() const override;
 
+  /// Batch boxes of the atomic grids relative to the atomic center, empty 
+  /// batches have lo > up. The grid is fixed, boxes are cached on first use
+  std::unordered_map< AtomicNumber, std::vector<box_type> > batch_boxes_;
+
+  /// Batches of each atom whose points are in no task (on any rank): empty
+  /// or negligible when the tasks were generated, or part of a dropped task.
+  /// The tasks are regenerated once any of them becomes significant
+  std::vector< std::vector<char> > untracked_batches_;
+
+  /// Partition batch generation / screening across ranks
+  bool distributed_generation_ = false;
+
+  /// Every rank generates all batches and keeps its assigned tasks
+  std::vector< XCTask > create_local_tasks_replicated_() const;
+
+  /// Each rank generates a cyclic partition of the batches, the cost
+  /// estimates are exchanged to obtain the same assignment as the 
+  /// replicated generation, and only the assigned batches missing locally
+  /// are generated afterwards
+  std::vector< XCTask > create_local_tasks_distributed_() const;
+
+  /// Generate and screen a batch, returns false if the batch is negligible
+  bool generate_task_( batcher_type& batcher, size_t ibatch, int32_t iAtom,
+    const ShellSpatialIndex& shell_index, 
+    const ShellSpatialIndex& protonic_shell_index, XCTask& task ) const;
+
+  /// Screen a task against the box [lo, up], resets the derived screening
+  void screen_task_( XCTask& task, const std::array<double,3>& lo,
+    const std::array<double,3>& up, const ShellSpatialIndex& shell_index,
+    const ShellSpatialIndex& protonic_shell_index ) const;
+
+  /// Merge the equivalent local tasks (see group_equivalent_tasks)
+  void merge_equivalent_tasks_();
+
+  /// Total cost estimate of the local tasks
+  size_t local_cost_() const;
+
+  /// Rebalance the tasks if the local cost of any rank changed by more than
+  /// rebalance_threshold (relative) from cost_old
+  void rebalance_on_drift_( size_t cost_old, double rebalance_threshold );
+
+  /// Populate batch_boxes_ / untracked_batches_ for the current geometry
+  /// and basis, if not already done
+  void cache_batches_();
+
+  /// Whether any untracked batch is significant for shell_index (collective)
+  bool untracked_batches_significant_( const ShellSpatialIndex& shell_index );
+
+  /// Mark the batches of the parent atom which may hold points of a 
+  /// (dropped) task as untracked
+  void untrack_task_( const XCTask& task );
+
+  /// Drop the tasks without points or significant shells, their batches
+  /// become untracked
+  void drop_negligible_tasks_();
+
+  /// Regenerate the local tasks from the grid (collective)
+  void regenerate_tasks_();
+
+  /// Replace the (partitioned) weights of the local tasks by the quadrature
+  /// weights of the atomic grids at the current geometry
+  void restore_quadrature_weights_();
+
 public:
 
   HostReplicatedLoadBalancer() = delete;
@@ -31,9 +97,21 @@ public:
 
   virtual ~HostReplicatedLoadBalancer() noexcept;
 
+  void update_geometry( const Molecule&, double rebalance_threshold ) override;
+  void update_basis( const basis_type&, const basis_type* protonic_basis,
+    double rebalance_threshold ) override;
+  void adapt_task_sizes( size_t min_cost, size_t max_cost, 
+    double max_nbe_growth ) override;
+  void compact_tasks( double weight_tol, double rebalance_threshold ) override;
+
+  inline void set_distributed_generation( bool distributed ) {
+    distributed_generation_ = distributed;
+  }
+
+  /// Screen the shells of a basis set against a batch bounding box
   virtual std::pair< std::vector<int32_t>, size_t > micro_batch_screen(
-    const BasisSet<double>&, const std::array<double,3>&,
-    const std::array<double,3>& ) const = 0;
+    const BasisSet<double>&, const ShellSpatialIndex&, 
+    const std::array<double,3>&, const std::array<double,3>& ) const = 0;
 
 };
 
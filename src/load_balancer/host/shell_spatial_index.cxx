@@ -0,0 +1,131 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "shell_spatial_index.hpp"
+#include <gauxc/util/geometry.hpp>
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace GauXC  {
+namespace detail {
+
+ShellSpatialIndex::ShellSpatialIndex( const BasisSet<double>& bs ) {
+
+  const int32_t nshells = bs.size();
+  if( !nshells ) return;
+
+  shells_.resize( nshells );
+  std::iota( shells_.begin(), shells_.end(), 0 );
+
+  nodes_.reserve( 2 * (nshells / leaf_size + 1) );
+  centers_.resize( nshells );
+  radii_.resize( nshells );
+  for( int32_t i = 0; i < nshells; ++i ) {
+    centers_[i] = bs[i].O();
+    radii_[i]   = bs[i].cutoff_radius();
+  }
+
+  build_( 0, nshells );
+
+  // Store the shell data in tree order
+  std::vector<point_type> centers( nshells );
+  std::vector<double>     radii( nshells );
+  for( int32_t i = 0; i < nshells; ++i ) {
+    centers[i] = centers_[shells_[i]];
+    radii[i]   = radii_[shells_[i]];
+  }
+  centers_ = std::move(centers);
+  radii_   = std::move(radii);
+
+}
+
+int32_t ShellSpatialIndex::build_( int32_t begin, int32_t end ) {
+
+  const int32_t inode = nodes_.size();
+  nodes_.emplace_back();
+
+  // Bounding box of the cutoff spheres and of their centers
+  constexpr auto inf = std::numeric_limits<double>::infinity();
+  point_type lo = {inf, inf, inf}, up = {-inf, -inf, -inf};
+  point_type c_lo = lo, c_up = up;
+  for( int32_t i = begin; i < end; ++i ) {
+    const auto& c = centers_[shells_[i]];
+    const auto  r = radii_[shells_[i]];
+    for( int k = 0; k < 3; ++k ) {
+      lo[k]   = std::min( lo[k], c[k] - r );
+      up[k]   = std::max( up[k], c[k] + r );
+      c_lo[k] = std::min( c_lo[k], c[k] );
+      c_up[k] = std::max( c_up[k], c[k] );
+    }
+  }
+  nodes_[inode].lo = lo;
+  nodes_[inode].up = up;
+
+  if( end - begin <= leaf_size ) {
+    nodes_[inode].begin = begin;
+    nodes_[inode].end   = end;
+    return inode;
+  }
+
+  // Median split along the longest extent of the centers
+  int axis = 0;
+  for( int k = 1; k < 3; ++k )
+    if( c_up[k] - c_lo[k] > c_up[axis] - c_lo[axis] ) axis = k;
+
+  const int32_t mid = begin + (end - begin) / 2;
+  std::nth_element( shells_.begin() + begin, shells_.begin() + mid,
+    shells_.begin() + end, [&]( auto a, auto b ) {
+      return centers_[a][axis] < centers_[b][axis];
+    });
+
+  const auto left  = build_( begin, mid );
+  const auto right = build_( mid,   end );
+  nodes_[inode].left  = left;
+  nodes_[inode].right = right;
+
+  return inode;
+}
+
+std::vector<int32_t> ShellSpatialIndex::query( const point_type& lo,
+  const point_type& up ) const {
+
+  std::vector<int32_t> shell_list;
+  if( nodes_.empty() ) return shell_list;
+
+  auto box_overlap = [&]( const node& n ) {
+    for( int k = 0; k < 3; ++k )
+      if( n.up[k] < lo[k] or n.lo[k] > up[k] ) return false;
+    return true;
+  };
+
+  std::vector<int32_t> stack; stack.reserve( 64 );
+  stack.push_back( 0 );
+  while( !stack.empty() ) {
+
+    const auto& n = nodes_[stack.back()]; stack.pop_back();
+    if( !box_overlap(n) ) continue;
+
+    if( n.left >= 0 ) {
+      stack.push_back( n.left  );
+      stack.push_back( n.right );
+      continue;
+    }
+
+    for( int32_t i = n.begin; i < n.end; ++i )
+    if( geometry::cube_sphere_intersect( lo, up, centers_[i], radii_[i] ) )
+      shell_list.emplace_back( shells_[i] );
+
+  }
+
+  std::sort( shell_list.begin(), shell_list.end() );
+  return shell_list;
+
+}
+
+}
+}
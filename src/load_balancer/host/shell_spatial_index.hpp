@@ -0,0 +1,56 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/basisset.hpp>
+#include <array>
+#include <vector>
+
+namespace GauXC  {
+namespace detail {
+
+/**
+ *  @brief Bounding volume hierarchy over the cutoff spheres of the shells
+ *  of a basis set
+ *
+ *  Replaces the linear scan over all shells in micro batch screening by a
+ *  tree query, O(log(nshells) + k) for k intersecting shells.
+ */
+class ShellSpatialIndex {
+
+  using point_type = std::array<double,3>;
+
+  struct node {
+    point_type lo, up;    ///< Bounding box of the cutoff spheres in the node
+    int32_t    left  = -1; ///< Child nodes (-1 for leaves)
+    int32_t    right = -1;
+    int32_t    begin = 0;  ///< Range of shells (leaves only)
+    int32_t    end   = 0;
+  };
+
+  std::vector<node>       nodes_;
+  std::vector<int32_t>    shells_;  ///< Shell indices in tree order
+  std::vector<point_type> centers_; ///< Shell centers in tree order
+  std::vector<double>     radii_;   ///< Shell cutoff radii in tree order
+
+  int32_t build_( int32_t begin, int32_t end );
+
+public:
+
+  static constexpr int32_t leaf_size = 8;
+
+  ShellSpatialIndex() = default;
+  ShellSpatialIndex( const BasisSet<double>& bs );
+
+  /// Shells (ascending) whose cutoff sphere intersects the box [lo, up]
+  std::vector<int32_t> query( const point_type& lo, const point_type& up ) const;
+
+};
+
+}
+}
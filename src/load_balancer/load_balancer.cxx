@@ -6,6 +6,8 @@
  * See LICENSE.txt for details
  */
 #include "load_balancer_impl.hpp"
+#include <algorithm>
+#include <utility>
 
 namespace GauXC {
 
@@ -28,24 +30,87 @@ const std::vector<XCTask>& LoadBalancer::get_tasks() const {
 }
 std::vector<XCTask>& LoadBalancer::get_tasks() {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->increment_generation();
   return pimpl_->get_tasks();
 }
 
+size_t LoadBalancer::generation() const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->generation();
+}
+
+void LoadBalancer::set_tasks( std::vector<XCTask>&& tasks ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->increment_generation();
+  pimpl_->set_tasks( std::move(tasks) );
+}
+
+void LoadBalancer::reorder_tasks( const std::vector<size_t>& perm ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  if( std::is_sorted( perm.begin(), perm.end() ) and 
+      perm.size() == std::as_const(*pimpl_).get_tasks().size() ) return; // Same order
+  pimpl_->increment_generation();
+  pimpl_->reorder_tasks( perm );
+}
+
+bool LoadBalancer::tasks_generated() const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->tasks_generated();
+}
+
 void LoadBalancer::rebalance_weights() {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->increment_generation();
   pimpl_->rebalance_weights();
 }
 
 void LoadBalancer::rebalance_exc_vxc() {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->increment_generation();
   pimpl_->rebalance_exc_vxc();
 }
 
 void LoadBalancer::rebalance_exx() {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->increment_generation();
   pimpl_->rebalance_exx();
 }
 
+void LoadBalancer::update_geometry( const Molecule& mol, 
+  double rebalance_threshold ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->increment_generation();
+  pimpl_->update_geometry( mol, rebalance_threshold );
+}
+
+void LoadBalancer::update_basis( const basis_type& bs, 
+  double rebalance_threshold ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->increment_generation();
+  pimpl_->update_basis( bs, nullptr, rebalance_threshold );
+}
+
+void LoadBalancer::update_basis( const basis_type& bs, 
+  const basis_type& protonic_bs, double rebalance_threshold ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->increment_generation();
+  pimpl_->update_basis( bs, &protonic_bs, rebalance_threshold );
+}
+
+void LoadBalancer::adapt_task_sizes( size_t min_cost, size_t max_cost, 
+  double max_nbe_growth ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->increment_generation();
+  pimpl_->adapt_task_sizes( min_cost, max_cost, max_nbe_growth );
+}
+
+void LoadBalancer::compact_tasks( double weight_tol, 
+  double rebalance_threshold ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->increment_generation();
+  pimpl_->compact_tasks( weight_tol, rebalance_threshold );
+}
+
 const util::Timer& LoadBalancer::get_timings() const {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
   return pimpl_->get_timings();
@@ -93,6 +158,11 @@ const LoadBalancer::shell_pair_type& LoadBalancer::shell_pairs() {
   return pimpl_->shell_pairs();
 }
 
+const LoadBalancer::shell_pair_type& LoadBalancer::shell_pairs_with_multipoles() {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->shell_pairs_with_multipoles();
+}
+
 const LoadBalancer::basis_type& LoadBalancer::protonic_basis() const {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
   return pimpl_->protonic_basis();
@@ -54,15 +54,18 @@ LoadBalancerImpl::LoadBalancerImpl( LoadBalancerImpl&& ) noexcept = default;
 LoadBalancerImpl::~LoadBalancerImpl() noexcept = default;
 
 const std::vector<XCTask>& LoadBalancerImpl::get_tasks() const {
-  if( not local_tasks_.size() ) GAUXC_GENERIC_EXCEPTION("No Tasks Created");
+  if( not tasks_generated_ ) GAUXC_GENERIC_EXCEPTION("No Tasks Created");
   return local_tasks_;
 }
 
 std::vector<XCTask>& LoadBalancerImpl::get_tasks() {
 
-  if( not local_tasks_.size() ) {
+  // A rank may legitimately hold no tasks, the (collective) generation is
+  // tracked separately
+  if( not tasks_generated_ ) {
     auto create_tasks_st = std::chrono::high_resolution_clock::now();
     local_tasks_ = create_local_tasks_();
+    tasks_generated_ = true;
     auto create_tasks_en = std::chrono::high_resolution_clock::now();
     std::chrono::duration<double> create_tasks_dr = create_tasks_en - create_tasks_st; 
     timer_.add_timing("LoadBalancer.CreateTasks", create_tasks_dr);
@@ -72,6 +75,51 @@ std::vector<XCTask>& LoadBalancerImpl::get_tasks() {
   return local_tasks_;
 }
 
+void LoadBalancerImpl::set_tasks( std::vector<XCTask>&& tasks ) {
+  local_tasks_ = std::move(tasks);
+  tasks_generated_ = true;
+}
+
+void LoadBalancerImpl::reorder_tasks( const std::vector<size_t>& perm ) {
+
+  if( perm.size() != local_tasks_.size() )
+    GAUXC_GENERIC_EXCEPTION("Invalid Task Permutation");
+
+  std::vector<XCTask> reordered; reordered.reserve( perm.size() );
+  for( auto i : perm ) reordered.emplace_back( std::move(local_tasks_.at(i)) );
+  local_tasks_ = std::move(reordered);
+
+}
+
+bool LoadBalancerImpl::tasks_generated() const {
+  return tasks_generated_;
+}
+
+size_t LoadBalancerImpl::generation() const {
+  return generation_;
+}
+
+void LoadBalancerImpl::increment_generation() {
+  ++generation_;
+}
+
+void LoadBalancerImpl::update_geometry( const Molecule&, double ) {
+  GAUXC_GENERIC_EXCEPTION("update_geometry Not Implemented for this LoadBalancer");
+}
+
+void LoadBalancerImpl::update_basis( const basis_type&, const basis_type*, 
+  double ) {
+  GAUXC_GENERIC_EXCEPTION("update_basis Not Implemented for this LoadBalancer");
+}
+
+void LoadBalancerImpl::adapt_task_sizes( size_t, size_t, double ) {
+  GAUXC_GENERIC_EXCEPTION("adapt_task_sizes Not Implemented for this LoadBalancer");
+}
+
+void LoadBalancerImpl::compact_tasks( double, double ) {
+  GAUXC_GENERIC_EXCEPTION("compact_tasks Not Implemented for this LoadBalancer");
+}
+
 const util::Timer& LoadBalancerImpl::get_timings() const {
   return timer_;
 }
@@ -137,6 +185,12 @@ const LoadBalancerImpl::shell_pair_type& LoadBalancerImpl::shell_pairs() {
   }
   return *shell_pairs_;
 }
+const LoadBalancerImpl::shell_pair_type& 
+  LoadBalancerImpl::shell_pairs_with_multipoles() {
+  shell_pairs();
+  shell_pairs_->generate_multipoles(*basis_);
+  return *shell_pairs_;
+}
 
 const LoadBalancerImpl::basis_type& LoadBalancerImpl::protonic_basis() const {
   if(!protonic_basis_) 
@@ -34,9 +34,13 @@ protected:
   std::shared_ptr<basis_map_type> protonic_basis_map_;
 
   std::vector< XCTask >     local_tasks_;
+  bool                      tasks_generated_ = false; ///< Replicated across ranks,
+                                                      ///< local_tasks_ may be empty
 
   LoadBalancerState         state_;
 
+  size_t                    generation_ = 0; ///< Generation of local_tasks_
+
   util::Timer               timer_;
 
   virtual std::vector< XCTask > create_local_tasks_() const = 0;
@@ -66,11 +70,24 @@ public:
 
   const std::vector< XCTask >& get_tasks() const;
         std::vector< XCTask >& get_tasks()      ;
+  void set_tasks( std::vector< XCTask >&& );
+  void reorder_tasks( const std::vector<size_t>& perm );
+  bool tasks_generated() const;
+
+  size_t generation() const;
+  void   increment_generation();
 
   void rebalance_weights();
   void rebalance_exc_vxc();
   void rebalance_exx();
 
+  virtual void update_geometry( const Molecule&, double rebalance_threshold );
+  virtual void update_basis( const basis_type&, const basis_type* protonic_basis,
+    double rebalance_threshold );
+  virtual void adapt_task_sizes( size_t min_cost, size_t max_cost, 
+    double max_nbe_growth );
+  virtual void compact_tasks( double weight_tol, double rebalance_threshold );
+
   const util::Timer& get_timings() const;
 
   size_t max_npts()       const;
@@ -84,6 +101,7 @@ public:
   const basis_map_type& basis_map() const;
   const shell_pair_type& shell_pairs() const;
   const shell_pair_type& shell_pairs();
+  const shell_pair_type& shell_pairs_with_multipoles();
   const basis_type& protonic_basis()  const;
   const basis_map_type& protonic_basis_map() const;
 
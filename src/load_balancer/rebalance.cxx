@@ -6,39 +6,40 @@
  * See LICENSE.txt for details
  */
 #include "load_balancer_impl.hpp"
+#include "xc_task_arena.hpp"
 #include <gauxc/util/mpi.hpp>
 #include <gauxc/util/div_ceil.hpp>
-#include <fstream>
+#include <algorithm>
+#include <iterator>
+#include <limits>
 
 namespace GauXC::detail {
 
 #ifdef GAUXC_HAS_MPI
+/**
+ *  Redistribute the tasks of [begin,end) such that each rank holds a 
+ *  contiguous chunk of (roughly) equal cost of the global task sequence 
+ *  (ordered by rank, then local index). A task is assigned to the rank 
+ *  containing the midpoint of its global cost interval, each rank may send 
+ *  to / receive from any number of ranks. The tasks sent to each rank are 
+ *  flattened into an XCTaskArena and sent as soon as they are packed.
+ *
+ *  The global task order is retained in the returned tasks.
+ */
 template <typename TaskIterator, typename CostFunctor>
 auto rebalance(TaskIterator begin, TaskIterator end, const CostFunctor& cost, MPI_Comm comm) {
 
-  using hrt_t = std::chrono::high_resolution_clock;
-  using dur_t = std::chrono::duration<double, std::milli>;
-
   int world_rank, world_size;
   MPI_Comm_rank(comm, &world_rank);
   MPI_Comm_size(comm, &world_size);
 
-  MPI_Barrier(MPI_COMM_WORLD);
-  printf(
-  "RANK %d BEFORE REBALNACE: LW = %lu\n",
-    world_rank,
-    std::accumulate(begin, end, 0ul,
-      [=](const auto& a, const auto& b){ return a + cost(b); })
-  );
-
   // Compute local task costs
-  size_t ntask_local = std::distance(begin, end);
+  const size_t ntask_local = std::distance(begin, end);
   std::vector<size_t> local_task_cost(ntask_local);
   std::transform(begin, end, local_task_cost.begin(),
     [&](const auto& task){ return cost(task); });
 
-  // Compute task prefix sum
-  auto prefix_st = hrt_t::now();
+  // Compute (exclusive) task prefix sum
   std::vector<size_t> local_prefix_sum(ntask_local);
   auto [local_task_sum, prefix_seed] =
     mpi_prefix_sum(local_task_cost.begin(), local_task_cost.end(),
@@ -46,315 +47,94 @@ auto rebalance(TaskIterator begin, TaskIterator end, const CostFunctor& cost, MP
 
   // Compute total/avg cost
   auto total_task_sum = allreduce( local_task_sum, MPI_SUM, comm );
-  size_t task_avg = util::div_ceil(total_task_sum, world_size);
-
-
-  // Generate outgoing messages
-  struct task_message {
-    int dst;
-    size_t idx_st, idx_en, vol;
-  };
-
-  std::vector<task_message> task_outgoing;
-  auto it = local_prefix_sum.begin();
-  for( int i = 0; i < world_size; ++i) {
-    auto n_it = std::lower_bound(it, local_prefix_sum.end(), i,
-      [=](auto a, auto b) { return a / task_avg < b+1; });
-    size_t st_idx = std::distance(local_prefix_sum.begin(), it  );
-    size_t en_idx = std::distance(local_prefix_sum.begin(), n_it);
-    if(st_idx != en_idx and i != world_rank) {
-      size_t vol = 0;
-      for( size_t t = st_idx; t < en_idx; ++t ) {
-        vol += (begin + t)->volume();
-      }
-      task_outgoing.push_back({i,st_idx,en_idx,vol});
-      size_t work_to_send = 0;
-      for( size_t t = st_idx; t < en_idx; ++t ) {
-        work_to_send += cost(*(begin + t));
-      }
-      printf("RANK %d SENDING %lu to RANK %d\n", world_rank, work_to_send, i);
-    }
-    it = n_it;
-  }
-
-  auto prefix_en = hrt_t::now();
-
-  // Sanity check
-  if(task_outgoing.size() > 2 )
-    GAUXC_GENERIC_EXCEPTION("Incorrect Outgoing Task Message Size RANK = " + std::to_string(world_rank) + " SZ = " + std::to_string(task_outgoing.size()));
-
-  MPI_Barrier(comm);
-  ring_execute(
-  [&]() {
-    printf("RANK %d MESSAGES:\n", world_rank);
-    for(auto& msg : task_outgoing) {
-      printf("  DST %d ST %lu EN %lu V %lu\n",
-        msg.dst, msg.idx_st, msg.idx_en, msg.vol);
-    }
-  } , comm);
-  MPI_Barrier(comm);
-
-  std::vector<MPI_Request> packed_req; packed_req.reserve(8);
-
-  // Ask neighbors if they're sending messages
-  int recv_from_backward = 0;
-  int recv_from_forward = 0;
-  int send_forward = 0;
-  int send_backward = 0;
-  if(world_rank) {
-    auto& req = packed_req.emplace_back();
-    MPI_Irecv( &recv_from_backward, 1, MPI_INT, world_rank-1, 0, comm, &req );
-  }
-  if(world_rank < world_size-1) {
-    auto& req = packed_req.emplace_back();
-    MPI_Irecv( &recv_from_forward, 1, MPI_INT, world_rank+1, 1, comm, &req );
-  }
-  if(world_rank < world_size-1) {
-    auto& req = packed_req.emplace_back();
-    for(auto& msg : task_outgoing) send_forward |= (msg.dst == world_rank+1);
-    MPI_Isend( &send_forward, 1, MPI_INT, world_rank+1, 0, comm, &req );
-  }
-  if(world_rank) {
-    auto& req = packed_req.emplace_back();
-    for(auto& msg : task_outgoing) send_backward |= (msg.dst == world_rank-1);
-    MPI_Isend( &send_backward, 1, MPI_INT, world_rank-1, 1, comm, &req );
-  }
-
-
-
-  // Wait for messages to complete
-  if(packed_req.size()) {
-    MPI_Waitall(packed_req.size(), packed_req.data(), MPI_STATUS_IGNORE);
-  }
-  // Reset messages
-  packed_req.clear();
-
-  printf("RANK %d, BW %d, FW %d\n", world_rank, recv_from_backward, recv_from_forward );
-  MPI_Barrier(MPI_COMM_WORLD);
-
-
-#if 0
-  // Sanity check
-  if( world_rank < world_size - 1 and task_outgoing.size() != 1 )
-    GAUXC_GENERIC_EXCEPTION("Incorrect Outgoing Task Message Size RANK = " + std::to_string(world_rank));
-  if( world_rank == world_size - 1 and task_outgoing.size() )
-    GAUXC_GENERIC_EXCEPTION("Incorrect Outgoing Task Message Size RANK = " + std::to_string(world_rank));
-#endif
-
-  // Allocate incoming and outgoing buffers = 64 MiB
-  constexpr size_t packed_buffer_size = 64 * 1024 * 1024;
-  MPI_Packed_Buffer packed_outgoing_forward( packed_buffer_size, comm );
-  MPI_Packed_Buffer packed_incoming_forward( packed_buffer_size, comm );
-  MPI_Packed_Buffer packed_outgoing_backward( packed_buffer_size, comm );
-  MPI_Packed_Buffer packed_incoming_backward( packed_buffer_size, comm );
-
-  // Post receives
-  if(recv_from_backward) {
-    auto& packed_recv_req = packed_req.emplace_back();
-    MPI_Irecv( packed_incoming_backward.buffer(), packed_buffer_size, MPI_PACKED,
-      world_rank-1, 0, comm, &packed_recv_req );
-  }
-  if(recv_from_forward) {
-    auto& packed_recv_req = packed_req.emplace_back();
-    MPI_Irecv( packed_incoming_forward.buffer(), packed_buffer_size, MPI_PACKED,
-      world_rank+1, 0, comm, &packed_recv_req );
+  if( !total_task_sum ) 
+    return std::vector<XCTask>( std::make_move_iterator(begin), 
+      std::make_move_iterator(end) );
+  const size_t task_avg = util::div_ceil(total_task_sum, world_size);
+
+  // Destination of each task (non-decreasing in task index), the local 
+  // tasks destined for rank i are [dst_offset[i], dst_offset[i+1])
+  std::vector<size_t> dst_offset( world_size + 1, 0 );
+  for( size_t i = 0; i < ntask_local; ++i ) {
+    const size_t mid = local_prefix_sum[i] + local_task_cost[i] / 2;
+    const int dst = std::min<size_t>( mid / task_avg, world_size - 1 );
+    dst_offset[dst+1]++;
   }
-
-  auto pack_st = hrt_t::now();
-  {
-
-  //std::ofstream ofile("task_send." + std::to_string(world_rank) + ".txt");
-
-  auto pack_msg = [&](const auto& msg, auto& mpi_buffer) {
-    size_t ntask_send = msg.idx_en - msg.idx_st;
-    //ofile << "DEST " << msg.dst << std::endl;
-    mpi_buffer.pack(ntask_send); //ofile << ntask_send << std::endl;
-    for(size_t i = msg.idx_st; i < msg.idx_en; ++i) {
-      const auto& task = *(begin + i);
-      mpi_buffer.pack(task.iParent);
-      mpi_buffer.pack(task.npts);
-      mpi_buffer.pack(task.points);
-      mpi_buffer.pack(task.weights);
-      mpi_buffer.pack(task.bfn_screening.shell_list);
-      mpi_buffer.pack(task.bfn_screening.nbe);
-      mpi_buffer.pack(task.protonic_bfn_screening.shell_list);
-      mpi_buffer.pack(task.protonic_bfn_screening.nbe);
-      mpi_buffer.pack(task.cou_screening.shell_list);
-      mpi_buffer.pack(task.cou_screening.shell_pair_list);
-      mpi_buffer.pack(task.cou_screening.shell_pair_idx_list);
-      mpi_buffer.pack(task.cou_screening.nbe);
-      mpi_buffer.pack(task.dist_nearest);
-      //ofile << task.iParent << ", " << task.npts << ", " << task.dist_nearest <<
-      //  ", " << task.bfn_screening.nbe << ", " << task.points.size() <<
-      //  ", " << task.cou_screening.nbe << ", " << task.cou_screening.shell_list.size() <<
-      //  ", " << task.cou_screening.shell_pair_list.size() << ", " << task.cou_screening.shell_pair_idx_list.size()
-      //  << std::endl;
-    }
-
-    // Send data to neighbor
-    auto& packed_send_req = packed_req.emplace_back();
-    auto* buffer = mpi_buffer.buffer();
-    MPI_Isend(buffer, packed_buffer_size, MPI_PACKED, msg.dst, 0,
-      comm, &packed_send_req);
+  std::partial_sum( dst_offset.begin(), dst_offset.end(), dst_offset.begin() );
+
+  // Exchange the extents of the outgoing task arenas
+  using extents_type = XCTaskArena::extents_type;
+  std::vector<XCTaskArena>  outgoing( world_size );
+  std::vector<extents_type> send_extents( world_size, extents_type{} );
+  std::vector<extents_type> recv_extents( world_size, extents_type{} );
+  for( int i = 0; i < world_size; ++i ) if( i != world_rank ) 
+    send_extents[i] = XCTaskArena::extents( begin + dst_offset[i], 
+      begin + dst_offset[i+1] );
+  MPI_Alltoall( send_extents.data(), sizeof(extents_type), MPI_BYTE,
+    recv_extents.data(), sizeof(extents_type), MPI_BYTE, comm );
+
+  // Post sends / receives of the arena buffers. Buffers are visited in the 
+  // same order on both ends, message ordering between a pair of ranks
+  // matches them
+  auto post_buffers = [&]( XCTaskArena& arena, int rank, bool send, 
+    std::vector<MPI_Request>& reqs ) {
+    arena.for_each_buffer( [&]( void* ptr, size_t nbytes ) {
+      if( !nbytes ) return;
+      if( nbytes > size_t(std::numeric_limits<int>::max()) )
+        GAUXC_GENERIC_EXCEPTION("Task Buffer Exceeds MPI Message Size");
+      auto& req = reqs.emplace_back();
+      if( send ) MPI_Isend( ptr, nbytes, MPI_BYTE, rank, 0, comm, &req );
+      else       MPI_Irecv( ptr, nbytes, MPI_BYTE, rank, 0, comm, &req );
+    });
   };
 
-  // Pack and send to neighbor
-  #if 0
-  if(send_backward or send_forward) {
-    // Pack Data
-    auto& msg = task_outgoing[0];
-    if( msg.dst != world_rank+1 )
-      GAUXC_GENERIC_EXCEPTION("Invalid Destination Rank");
-
-    size_t ntask_send = msg.idx_en - msg.idx_st;
-
-    //std::ofstream ofile("task_send." + std::to_string(world_rank) + ".txt");
-
-    packed_outgoing.pack(ntask_send); //ofile << ntask_send << std::endl;
-    //printf("RANK = %d SEND = %lu\n", world_rank, ntask_send);
-    for(size_t i = msg.idx_st; i < msg.idx_en; ++i) {
-      const auto& task = *(begin + i);
-      packed_outgoing.pack(task.iParent);
-      packed_outgoing.pack(task.npts);
-      packed_outgoing.pack(task.points);
-      packed_outgoing.pack(task.weights);
-      packed_outgoing.pack(task.bfn_screening.shell_list);
-      packed_outgoing.pack(task.bfn_screening.nbe);
-      packed_outgoing.pack(task.cou_screening.shell_list);
-      packed_outgoing.pack(task.cou_screening.shell_pair_list);
-      packed_outgoing.pack(task.cou_screening.shell_pair_idx_list);
-      packed_outgoing.pack(task.cou_screening.nbe);
-      packed_outgoing.pack(task.dist_nearest);
-      //ofile << task.iParent << ", " << task.npts << ", " << task.dist_nearest <<
-      //  ", " << task.bfn_screening.nbe << ", " << task.points.size() << std::endl;
-    }
-
-    // Send data to neighbor
-    auto& packed_send_req = packed_req.emplace_back();
-    auto* buffer = packed_outgoing.buffer();
-    MPI_Isend(buffer, packed_buffer_size, MPI_PACKED, world_rank+1, 0,
-      comm, &packed_send_req);
-
-  }
-  #else
-  for( auto& msg : task_outgoing ) {
-    if(msg.dst == world_rank + 1)
-      pack_msg(msg, packed_outgoing_forward);
-    else
-      pack_msg(msg, packed_outgoing_backward);
+  // Post receives, recv_src maps each request to its source rank
+  std::vector<XCTaskArena> incoming( world_size );
+  std::vector<MPI_Request> recv_req;
+  std::vector<int>         recv_src;
+  std::vector<int>         recv_pending( world_size, 0 );
+  for( int i = 0; i < world_size; ++i ) if( recv_extents[i][0] ) {
+    incoming[i].resize( recv_extents[i] );
+    post_buffers( incoming[i], i, false, recv_req );
+    recv_pending[i] = recv_req.size() - recv_src.size();
+    recv_src.resize( recv_req.size(), i );
   }
-  #endif
-  }
-
-  auto pack_en = hrt_t::now();
-
-  // Local task storage
-  std::vector< XCTask > local_work;
-
-  // Move local tasks to task storage
-  {
-    auto func = [=](auto a, auto b) { return a / task_avg < b+1; };
-    auto lps_begin = local_prefix_sum.begin();
-    auto lps_end   = local_prefix_sum.end();
-    auto local_begin =
-      world_rank ? std::lower_bound(lps_begin,lps_end,world_rank-1,func) : lps_begin;
-    auto local_end = std::lower_bound(local_begin, lps_end, world_rank,func);
-    size_t st_idx = std::distance(lps_begin, local_begin);
-    size_t en_idx = std::distance(lps_begin, local_end  );
 
-    size_t local_cost = 0;
-    for(size_t i = st_idx; i < en_idx; ++i) {
-      local_work.emplace_back( std::move(*(begin + i)) );
-      local_cost += cost(local_work.back());
-    }
-    printf("RANK %d LC %lu\n", world_rank, local_cost);
-  }
-
-
-  // Wait on sends and receives
-  auto wait_st = hrt_t::now();
-  if(packed_req.size()) {
-    MPI_Waitall(packed_req.size(), packed_req.data(), MPI_STATUS_IGNORE);
+  // Pack and send outgoing tasks, starting with the ranks following this 
+  // one to spread the incoming traffic
+  std::vector<MPI_Request> send_req;
+  for( int j = 1; j < world_size; ++j ) {
+    const int i = (world_rank + j) % world_size;
+    if( !send_extents[i][0] ) continue;
+    outgoing[i] = XCTaskArena( begin + dst_offset[i], begin + dst_offset[i+1] );
+    post_buffers( outgoing[i], i, true, send_req );
   }
-  auto wait_en = hrt_t::now();
-
-
-  auto unpack_st  = hrt_t::now();
-
-  {
-
-  //std::ofstream ofile("task_recv." + std::to_string(world_rank) + ".txt");
-  auto unpack_msg = [&](auto& mpi_buffer) {
-    size_t ntask_recv = 0;
-    //if(&mpi_buffer == &packed_incoming_backward) ofile << "SRC " << world_rank - 1 << std::endl;
-    //else ofile << "SRC " << world_rank + 1 << std::endl;
 
-    mpi_buffer.unpack(ntask_recv); //ofile << ntask_recv << std::endl;
-    for(size_t i = 0; i < ntask_recv; ++i) {
-      auto& task = local_work.emplace_back();
-      mpi_buffer.unpack(task.iParent);
-      mpi_buffer.unpack(task.npts);
-      mpi_buffer.unpack(task.points);
-      mpi_buffer.unpack(task.weights);
-      mpi_buffer.unpack(task.bfn_screening.shell_list);
-      mpi_buffer.unpack(task.bfn_screening.nbe);
-      mpi_buffer.unpack(task.protonic_bfn_screening.shell_list);
-      mpi_buffer.unpack(task.protonic_bfn_screening.nbe);
-      mpi_buffer.unpack(task.cou_screening.shell_list);
-      mpi_buffer.unpack(task.cou_screening.shell_pair_list);
-      mpi_buffer.unpack(task.cou_screening.shell_pair_idx_list);
-      mpi_buffer.unpack(task.cou_screening.nbe);
-      mpi_buffer.unpack(task.dist_nearest);
-      //ofile << task.iParent << ", " << task.npts << ", " << task.dist_nearest <<
-      //  ", " << task.bfn_screening.nbe << ", " << task.points.size() <<
-      //  ", " << task.cou_screening.nbe << ", " << task.cou_screening.shell_list.size() <<
-      //  ", " << task.cou_screening.shell_pair_list.size() << ", " << task.cou_screening.shell_pair_idx_list.size()
-      //  << std::endl;
+  // Move local tasks to task storage, unpack the incoming tasks as the 
+  // messages from each source complete
+  std::vector< std::vector<XCTask> > work_by_src( world_size );
+  for( auto t = dst_offset[world_rank]; t < dst_offset[world_rank+1]; ++t )
+    work_by_src[world_rank].emplace_back( std::move(*(begin + t)) );
+
+  for( size_t nrecv = 0; nrecv < recv_req.size(); ++nrecv ) {
+    int idx;
+    MPI_Waitany( recv_req.size(), recv_req.data(), &idx, MPI_STATUS_IGNORE );
+    const int src = recv_src[idx];
+    if( --recv_pending[src] == 0 ) {
+      incoming[src].unpack( work_by_src[src] );
+      incoming[src] = XCTaskArena();
     }
-  };
-  #if 0
-  // Unpack
-  if(world_rank) {
-    size_t ntask_recv = 0;
-    packed_incoming.unpack(ntask_recv); 
-    for(size_t i = 0; i < ntask_recv; ++i) {
-      auto& task = local_work.emplace_back();
-      packed_incoming.unpack(task.iParent);
-      packed_incoming.unpack(task.npts);
-      packed_incoming.unpack(task.points);
-      packed_incoming.unpack(task.weights);
-      packed_incoming.unpack(task.bfn_screening.shell_list);
-      packed_incoming.unpack(task.bfn_screening.nbe);
-      packed_incoming.unpack(task.cou_screening.shell_list);
-      packed_incoming.unpack(task.cou_screening.shell_pair_list);
-      packed_incoming.unpack(task.cou_screening.shell_pair_idx_list);
-      packed_incoming.unpack(task.cou_screening.nbe);
-      packed_incoming.unpack(task.dist_nearest);
-      //ofile << task.iParent << ", " << task.npts << ", " << task.dist_nearest <<
-      //  ", " << task.bfn_screening.nbe << ", " << task.points.size() << std::endl;
-    }
-
-  }
-  #else
-  if(recv_from_backward) unpack_msg(packed_incoming_backward);
-  if(recv_from_forward ) unpack_msg(packed_incoming_forward );
-  #endif
   }
-  auto unpack_en  = hrt_t::now();
 
+  if( send_req.size() )
+    MPI_Waitall( send_req.size(), send_req.data(), MPI_STATUSES_IGNORE );
 
-  MPI_Barrier(MPI_COMM_WORLD);
-  printf(
-  "RANK %d AFTER REBALNACE: PREFIX_DUR = %f PACK_DUR = %f WAIT_DUR = %f UNPACK_DUR = %f LW = %lu\n",
-    world_rank,
-    dur_t(prefix_en-prefix_st).count(),
-    dur_t(pack_en-pack_st).count(),
-    dur_t(wait_en-wait_st).count(),
-    dur_t(unpack_en-unpack_st).count(),
-    //local_work.size()
-    std::accumulate(local_work.begin(),local_work.end(),0ul,
-      [=](const auto& a, const auto& b){ return a + cost(b); })
-  );
+  // Concatenate in global task order
+  size_t ntask_new = 0;
+  for( const auto& w : work_by_src ) ntask_new += w.size();
+  std::vector< XCTask > local_work; local_work.reserve( ntask_new );
+  for( auto& w : work_by_src ) 
+    std::move( w.begin(), w.end(), std::back_inserter(local_work) );
 
   return local_work;
 
@@ -375,7 +155,6 @@ void LoadBalancerImpl::rebalance_weights() {
 void LoadBalancerImpl::rebalance_exc_vxc() {
 #ifdef GAUXC_HAS_MPI
   auto& tasks = get_tasks();
-  const size_t natoms = molecule().natoms();
   auto cost = [=](const auto& task){ return task.cost_exc_vxc(1); };
   auto new_tasks = rebalance( tasks.begin(), tasks.end(), cost, runtime_.comm());
   tasks = std::move(new_tasks);
@@ -385,10 +164,20 @@ void LoadBalancerImpl::rebalance_exc_vxc() {
 void LoadBalancerImpl::rebalance_exx() {
 #ifdef GAUXC_HAS_MPI
   auto& tasks = get_tasks();
-  auto cost = [=](const auto& task){ return task.cost_exx(); };
+
+  // Use measured costs (in ns) only if every rank has them. Tasks which
+  // were screened out (or finished below the timer resolution) measure
+  // ~0, the cost is clamped to 1 ns per point such that they still 
+  // distribute by size
+  const bool use_measured = allreduce( int(state_.exx_costs_measured), 
+    MPI_MIN, runtime_.comm() );
+  auto cost = [=](const auto& task) -> size_t { 
+    return use_measured ? 
+      std::max( size_t(1e9 * task.cost_exx_measured), task.points.size() ) :
+      task.cost_exx(); 
+  };
   auto new_tasks = rebalance( tasks.begin(), tasks.end(), cost, runtime_.comm());
   local_tasks_ = std::move(new_tasks);
-  MPI_Barrier(MPI_COMM_WORLD);
 #endif
 }
 
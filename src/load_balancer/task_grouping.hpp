@@ -0,0 +1,111 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/xc_task.hpp>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace GauXC  {
+namespace detail {
+
+/**
+ *  @brief Group the equivalent tasks of [begin, end)
+ *
+ *  Tasks are binned on their fingerprints in a single hashing pass. Within
+ *  a bin, each task is compared (equiv) against the first task of each
+ *  group of the bin, which only yields more than one group on fingerprint
+ *  collisions.
+ *
+ *  @param[in] fingerprint Functor returning the 64-bit fingerprint of a task,
+ *                         equivalent tasks must have equal fingerprints
+ *  @param[in] equiv       Task equivalence
+ *
+ *  @returns Indices (relative to begin, ascending) of the tasks in each
+ *           group. Groups are ordered on their first task.
+ */
+template <typename TaskIt, typename FingerprintOp, typename EquivOp>
+std::vector<std::vector<size_t>> group_equivalent_tasks( TaskIt begin,
+  TaskIt end, const FingerprintOp& fingerprint, const EquivOp& equiv ) {
+
+  const size_t ntasks = std::distance( begin, end );
+
+  std::vector<uint64_t> fp( ntasks );
+  #pragma omp parallel for
+  for( size_t i = 0; i < ntasks; ++i ) fp[i] = fingerprint( *(begin + i) );
+
+  // Bin on fingerprint
+  std::vector<std::vector<size_t>> bins;
+  {
+    std::unordered_map<uint64_t, size_t> bin_idx; bin_idx.reserve( ntasks );
+    for( size_t i = 0; i < ntasks; ++i ) {
+      auto [it, inserted] = bin_idx.try_emplace( fp[i], bins.size() );
+      if( inserted ) bins.emplace_back();
+      bins[it->second].push_back( i );
+    }
+  }
+
+  // Resolve fingerprint collisions
+  std::vector<std::vector<std::vector<size_t>>> bin_groups( bins.size() );
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t ib = 0; ib < bins.size(); ++ib ) {
+    auto& groups = bin_groups[ib];
+    for( auto i : bins[ib] ) {
+      auto g = std::find_if( groups.begin(), groups.end(), [&]( const auto& grp ) {
+        return equiv( *(begin + grp.front()), *(begin + i) );
+      });
+      if( g == groups.end() ) groups.push_back( {i} );
+      else                    g->push_back( i );
+    }
+  }
+
+  std::vector<std::vector<size_t>> groups; groups.reserve( bins.size() );
+  for( auto& bg : bin_groups )
+  for( auto& g  : bg ) groups.emplace_back( std::move(g) );
+
+  if( groups.size() != bins.size() )
+    std::sort( groups.begin(), groups.end(), []( const auto& a, const auto& b ) {
+      return a.front() < b.front();
+    });
+
+  return groups;
+
+}
+
+/**
+ *  @brief Merge a group of equivalent tasks (see group_equivalent_tasks)
+ *
+ *  The first task of the group is moved into the result, the points and
+ *  weights of the remaining tasks are appended in group order. Equivalence
+ *  is not rechecked.
+ */
+inline XCTask merge_task_group( std::vector<XCTask>& tasks,
+  const std::vector<size_t>& group ) {
+
+  size_t npts = 0;
+  for( auto i : group ) npts += tasks[i].points.size();
+
+  XCTask merged = std::move( tasks[group.front()] );
+  merged.points.reserve( npts );
+  merged.weights.reserve( npts );
+
+  for( auto it = group.begin() + 1; it != group.end(); ++it ) {
+    const auto& t = tasks[*it];
+    merged.points.insert( merged.points.end(), t.points.begin(), t.points.end() );
+    merged.weights.insert( merged.weights.end(), t.weights.begin(),
+      t.weights.end() );
+  }
+  merged.npts = merged.points.size();
+
+  return merged;
+
+}
+
+}
+}
@@ -0,0 +1,149 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "xc_task_arena.hpp"
+
+namespace GauXC  {
+namespace detail {
+
+void XCTaskArena::push_back( const XCTask& task ) {
+
+  if( task.weights.size() != task.points.size() )
+    GAUXC_GENERIC_EXCEPTION("Task Points / Weights Size Mismatch");
+
+  const auto& bfn_scr  = task.bfn_screening;
+  const auto& prot_scr = task.protonic_bfn_screening;
+  const auto& cou_scr  = task.cou_screening;
+
+  meta_.push_back( task_meta{
+    task.iParent, int32_t(task.points.size()),
+    bfn_scr.nbe, prot_scr.nbe, cou_scr.nbe,
+    int32_t(bfn_scr.shell_list.size()), int32_t(prot_scr.shell_list.size()),
+    int32_t(cou_scr.shell_list.size()), int32_t(cou_scr.shell_pair_list.size()),
+    int32_t(cou_scr.shell_pair_idx_list.size()),
+    task.dist_nearest, task.max_weight, task.cost_exx_measured
+  });
+
+  for( const auto& pt : task.points ) {
+    x_.push_back( pt[0] );
+    y_.push_back( pt[1] );
+    z_.push_back( pt[2] );
+  }
+  weights_.insert( weights_.end(), task.weights.begin(), task.weights.end() );
+
+  auto append = []( auto& v, const auto& src ) {
+    v.insert( v.end(), src.begin(), src.end() );
+  };
+  append( shell_list_,              bfn_scr.shell_list );
+  append( protonic_shell_list_,     prot_scr.shell_list );
+  append( cou_shell_list_,          cou_scr.shell_list );
+  append( cou_shell_pair_idx_list_, cou_scr.shell_pair_idx_list );
+  for( const auto& [i,j] : cou_scr.shell_pair_list ) {
+    cou_shell_pair_list_.push_back( i );
+    cou_shell_pair_list_.push_back( j );
+  }
+
+}
+
+void XCTaskArena::unpack( std::vector<XCTask>& tasks ) const {
+
+  const size_t ntasks = meta_.size();
+  const size_t ntasks_old = tasks.size();
+  tasks.resize( ntasks_old + ntasks );
+
+  // Offsets of each task into the flat buffers
+  const auto offsets = this->offsets();
+  if( offsets.back() != extents() )
+    GAUXC_GENERIC_EXCEPTION("Corrupted XCTaskArena");
+
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t i = 0; i < ntasks; ++i ) {
+
+    const auto& m = meta_[i];
+    const auto& o = offsets[i];
+    auto& task = tasks[ntasks_old + i];
+
+    task.iParent           = m.iParent;
+    task.npts              = m.npts;
+    task.dist_nearest      = m.dist_nearest;
+    task.max_weight        = m.max_weight;
+    task.cost_exx_measured = m.cost_exx_measured;
+
+    task.points.resize( m.npts );
+    for( int32_t ipt = 0; ipt < m.npts; ++ipt )
+      task.points[ipt] = { x_[o[1]+ipt], y_[o[1]+ipt], z_[o[1]+ipt] };
+    task.weights.assign( weights_.begin() + o[1],
+      weights_.begin() + o[1] + m.npts );
+
+    auto assign = []( auto& v, const auto& src, size_t off, size_t n ) {
+      v.assign( src.begin() + off, src.begin() + off + n );
+    };
+
+    task.bfn_screening.nbe = m.nbe;
+    assign( task.bfn_screening.shell_list, shell_list_, o[2], m.nshells );
+
+    task.protonic_bfn_screening.nbe = m.protonic_nbe;
+    assign( task.protonic_bfn_screening.shell_list, protonic_shell_list_,
+      o[3], m.protonic_nshells );
+
+    auto& cou_scr = task.cou_screening;
+    cou_scr.nbe = m.cou_nbe;
+    assign( cou_scr.shell_list, cou_shell_list_, o[4], m.cou_nshells );
+    assign( cou_scr.shell_pair_idx_list, cou_shell_pair_idx_list_, o[6],
+      m.cou_npair_idx );
+    cou_scr.shell_pair_list.resize( m.cou_npairs );
+    for( int32_t ip = 0; ip < m.cou_npairs; ++ip )
+      cou_scr.shell_pair_list[ip] = { cou_shell_pair_list_[o[5] + 2*ip],
+        cou_shell_pair_list_[o[5] + 2*ip + 1] };
+
+  }
+
+}
+
+XCTaskArena::extents_type XCTaskArena::extents() const {
+  return { meta_.size(), weights_.size(), shell_list_.size(),
+    protonic_shell_list_.size(), cou_shell_list_.size(),
+    cou_shell_pair_list_.size(), cou_shell_pair_idx_list_.size() };
+}
+
+std::vector<XCTaskArena::extents_type> XCTaskArena::offsets() const {
+  std::vector<extents_type> off( meta_.size() + 1 );
+  off[0] = { 0, 0, 0, 0, 0, 0, 0 };
+  for( size_t i = 0; i < meta_.size(); ++i ) {
+    const auto& m = meta_[i];
+    const auto& o = off[i];
+    off[i+1] = { o[0] + 1, o[1] + m.npts, o[2] + m.nshells, 
+      o[3] + m.protonic_nshells, o[4] + m.cou_nshells, o[5] + 2*m.cou_npairs,
+      o[6] + m.cou_npair_idx };
+  }
+  return off;
+}
+
+void XCTaskArena::reserve( const extents_type& ext ) {
+  meta_.reserve( ext[0] );
+  x_.reserve( ext[1] ); y_.reserve( ext[1] ); z_.reserve( ext[1] );
+  weights_.reserve( ext[1] );
+  shell_list_.reserve( ext[2] );
+  protonic_shell_list_.reserve( ext[3] );
+  cou_shell_list_.reserve( ext[4] );
+  cou_shell_pair_list_.reserve( ext[5] );
+  cou_shell_pair_idx_list_.reserve( ext[6] );
+}
+
+void XCTaskArena::resize( const extents_type& ext ) {
+  meta_.resize( ext[0] );
+  x_.resize( ext[1] ); y_.resize( ext[1] ); z_.resize( ext[1] );
+  weights_.resize( ext[1] );
+  shell_list_.resize( ext[2] );
+  protonic_shell_list_.resize( ext[3] );
+  cou_shell_list_.resize( ext[4] );
+  cou_shell_pair_list_.resize( ext[5] );
+  cou_shell_pair_idx_list_.resize( ext[6] );
+}
+
+}
+}
@@ -0,0 +1,149 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/xc_task.hpp>
+#include <array>
+#include <vector>
+
+namespace GauXC  {
+namespace detail {
+
+/**
+ *  @brief Flattened storage of a collection of XCTask instances
+ *
+ *  The per-task scalars are stored in a single array of task_meta, the
+ *  points in SoA form and the screening lists concatenated in task order
+ *  (CSR with the counts in task_meta). Packing a range of tasks touches a
+ *  fixed number of contiguous buffers, independent of the number of tasks,
+ *  such that the tasks may be communicated / copied as a handful of
+ *  contiguous transfers.
+ *
+ *  Only the data which is generated by the LoadBalancer is stored, the
+ *  submatrix maps are regenerated by the integrators.
+ */
+class XCTaskArena {
+
+public:
+
+  struct task_meta {
+    int32_t iParent;
+    int32_t npts;
+    int32_t nbe;
+    int32_t protonic_nbe;
+    int32_t cou_nbe;
+    int32_t nshells;
+    int32_t protonic_nshells;
+    int32_t cou_nshells;
+    int32_t cou_npairs;
+    int32_t cou_npair_idx;
+    double  dist_nearest;
+    double  max_weight;
+    double  cost_exx_measured;
+  };
+
+  /// Sizes of the flat buffers, see extents()
+  using extents_type = std::array<size_t,7>;
+
+private:
+
+  std::vector<task_meta> meta_;
+  std::vector<double>    x_, y_, z_, weights_;
+  std::vector<int32_t>   shell_list_;
+  std::vector<int32_t>   protonic_shell_list_;
+  std::vector<int32_t>   cou_shell_list_;
+  std::vector<int32_t>   cou_shell_pair_list_; ///< Pairs stored as (i,j)
+  std::vector<int32_t>   cou_shell_pair_idx_list_;
+
+public:
+
+  XCTaskArena() = default;
+
+  template <typename TaskIt>
+  XCTaskArena( TaskIt begin, TaskIt end ) {
+    reserve( extents(begin, end) );
+    for( auto it = begin; it != end; ++it ) push_back( *it );
+  }
+
+  /// Extents of the arena of the tasks [begin, end) (without packing them)
+  template <typename TaskIt>
+  static extents_type extents( TaskIt begin, TaskIt end ) {
+    extents_type ext = { 0, 0, 0, 0, 0, 0, 0 };
+    for( auto it = begin; it != end; ++it ) {
+      ext[0] += 1;
+      ext[1] += it->points.size();
+      ext[2] += it->bfn_screening.shell_list.size();
+      ext[3] += it->protonic_bfn_screening.shell_list.size();
+      ext[4] += it->cou_screening.shell_list.size();
+      ext[5] += 2*it->cou_screening.shell_pair_list.size();
+      ext[6] += it->cou_screening.shell_pair_idx_list.size();
+    }
+    return ext;
+  }
+
+  /// Append a task to the end of the arena
+  void push_back( const XCTask& task );
+
+  /// Unpack the tasks of the arena onto the end of tasks
+  void unpack( std::vector<XCTask>& tasks ) const;
+
+  /// Number of tasks
+  inline size_t size() const { return meta_.size(); }
+
+  /**
+   *  Sizes of the flat buffers: ntasks, npts, length of the basis / protonic
+   *  basis / Coulomb shell lists, length of the flattened Coulomb shell pair
+   *  list and of the shell pair index list.
+   */
+  extents_type extents() const;
+
+  /// Reserve storage for the buffers of a given extent
+  void reserve( const extents_type& ext );
+
+  /// Resize the buffers to a given extent, e.g. prior to receiving them
+  void resize( const extents_type& ext );
+
+  /// Offsets (in elements, extents order) of each task into the flat 
+  /// buffers, ntasks + 1 entries
+  std::vector<extents_type> offsets() const;
+
+  /**
+   *  Apply op( void* ptr, size_t elem_size, int iext ) to each of the 
+   *  contiguous buffers of the arena, the buffer holds extents()[iext] 
+   *  elements of elem_size bytes. Iteration order only depends on the 
+   *  extents, such that arenas with the same extents visit matching buffers
+   *  in the same order.
+   */
+  template <typename Op>
+  void for_each_typed_buffer( Op&& op ) {
+    auto apply = [&]( auto& v, int iext ) {
+      op( static_cast<void*>(v.data()), sizeof(v[0]), iext );
+    };
+    apply( meta_, 0 );
+    apply( x_, 1 ); apply( y_, 1 ); apply( z_, 1 ); apply( weights_, 1 );
+    apply( shell_list_, 2 );
+    apply( protonic_shell_list_, 3 );
+    apply( cou_shell_list_, 4 );
+    apply( cou_shell_pair_list_, 5 );
+    apply( cou_shell_pair_idx_list_, 6 );
+  }
+
+  /// Apply op( void* ptr, size_t nbytes ) to each of the contiguous buffers
+  /// of the arena (see for_each_typed_buffer)
+  template <typename Op>
+  void for_each_buffer( Op&& op ) {
+    const auto ext = extents();
+    for_each_typed_buffer( [&]( void* ptr, size_t elem_size, int iext ) {
+      op( ptr, elem_size * ext[iext] );
+    });
+  }
+
+};
+
+}
+}
@@ -24,6 +24,12 @@ void MolecularWeights::modify_weights(load_balancer_reference lb) const {
   if(not pimpl_) GAUXC_PIMPL_NOT_INITIALIZED();
   auto& timer = pimpl_->get_timer();
   timer.time_op("MolecularWeights",[&](){ pimpl_->modify_weights(lb);});
+
+  const auto& settings = pimpl_->settings();
+  if( settings.compact_tasks ) 
+    timer.time_op("MolecularWeights.Compaction",[&](){ 
+      lb.compact_tasks( settings.compaction_tol );
+    });
 }
 
 const util::Timer& MolecularWeights::get_timings() const {
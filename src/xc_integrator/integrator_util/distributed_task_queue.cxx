@@ -0,0 +1,167 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "distributed_task_queue.hpp"
+#include <limits>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef GAUXC_HAS_MPI
+namespace GauXC {
+
+DistributedTaskQueue::DistributedTaskQueue( detail::XCTaskArena&& arena,
+  MPI_Comm comm ) : comm_(comm), arena_(std::move(arena)) {
+
+  MPI_Comm_rank( comm_, &world_rank_ );
+  MPI_Comm_size( comm_, &world_size_ );
+
+  if( arena_.size() > size_t(std::numeric_limits<int32_t>::max()) )
+    GAUXC_GENERIC_EXCEPTION("Too Many Tasks for DistributedTaskQueue");
+
+  offsets_   = arena_.offsets();
+  next_task_ = 0;
+
+  const int64_t ntasks = arena_.size();
+  ntasks_.resize( world_size_ );
+  MPI_Allgather( &ntasks, 1, MPI_INT64_T, ntasks_.data(), 1, MPI_INT64_T,
+    comm_ );
+  exhausted_.assign( world_size_, 0 );
+
+  MPI_Win_create( &next_task_, sizeof(int64_t), sizeof(int64_t), 
+    MPI_INFO_NULL, comm_, &counter_win_ );
+  MPI_Win_create( offsets_.data(), offsets_.size() * sizeof(offsets_[0]),
+    sizeof(offsets_[0]), MPI_INFO_NULL, comm_, &offsets_win_ );
+  arena_.for_each_typed_buffer( [&]( void* ptr, size_t elem_size, int iext ) {
+    auto& win = buffer_wins_.emplace_back();
+    MPI_Win_create( ptr, elem_size * arena_.extents()[iext], elem_size,
+      MPI_INFO_NULL, comm_, &win );
+  });
+
+  // Passive target epoch for the lifetime of the queue
+  MPI_Win_lock_all( MPI_MODE_NOCHECK, counter_win_ );
+  MPI_Win_lock_all( MPI_MODE_NOCHECK, offsets_win_ );
+  for( auto& win : buffer_wins_ ) MPI_Win_lock_all( MPI_MODE_NOCHECK, win );
+
+}
+
+DistributedTaskQueue::~DistributedTaskQueue() noexcept {
+
+  MPI_Win_unlock_all( counter_win_ );
+  MPI_Win_unlock_all( offsets_win_ );
+  for( auto& win : buffer_wins_ ) MPI_Win_unlock_all( win );
+
+  MPI_Win_free( &counter_win_ );
+  MPI_Win_free( &offsets_win_ );
+  for( auto& win : buffer_wins_ ) MPI_Win_free( &win );
+
+}
+
+int64_t DistributedTaskQueue::read_counter_( int rank ) {
+  int64_t value;
+  MPI_Fetch_and_op( nullptr, &value, MPI_INT64_T, rank, 0, MPI_NO_OP,
+    counter_win_ );
+  MPI_Win_flush( rank, counter_win_ );
+  return value;
+}
+
+int64_t DistributedTaskQueue::fetch_add_counter_( int rank, int64_t value ) {
+  int64_t old_value;
+  MPI_Fetch_and_op( &value, &old_value, MPI_INT64_T, rank, 0, MPI_SUM,
+    counter_win_ );
+  MPI_Win_flush( rank, counter_win_ );
+  return old_value;
+}
+
+void DistributedTaskQueue::progress() {
+  #ifdef _OPENMP
+  if( omp_get_thread_num() ) return;
+  #endif
+  int flag;
+  MPI_Iprobe( MPI_ANY_SOURCE, MPI_ANY_TAG, comm_, &flag, MPI_STATUS_IGNORE );
+}
+
+std::pair<size_t,size_t> DistributedTaskQueue::next_local() {
+
+  progress();
+
+  const int64_t ntasks = arena_.size();
+  if( local_next_ >= ntasks ) return { 0, 0 };
+
+  // Guided chunks on the last observed counter, leaving a tail of smaller
+  // chunks which may be stolen by other ranks. Chunks hold at least one task
+  // per thread
+  #ifdef _OPENMP
+  const int64_t min_chunk = omp_get_max_threads();
+  #else
+  const int64_t min_chunk = 1;
+  #endif
+  const int64_t chunk = std::max( min_chunk, (ntasks - local_next_) / 8 );
+  const int64_t first = fetch_add_counter_( world_rank_, chunk );
+  const int64_t last  = std::min( ntasks, first + chunk );
+  local_next_ = last;
+
+  if( first >= ntasks ) return { 0, 0 };
+  return { first, last };
+
+}
+
+bool DistributedTaskQueue::steal( std::vector<XCTask>& tasks, 
+  stolen_range* range ) {
+
+  // Visit the other ranks in cyclic order, starting after this rank
+  for( int i = 1; i < world_size_; ++i ) {
+    const int victim = (world_rank_ + i) % world_size_;
+    if( exhausted_[victim] ) continue;
+
+    // Claim half of the remaining tasks
+    const int64_t ntasks = ntasks_[victim];
+    const int64_t next   = read_counter_( victim );
+    int64_t first = ntasks, last = ntasks;
+    if( next < ntasks ) {
+      const int64_t chunk = (ntasks - next + 1) / 2;
+      first = fetch_add_counter_( victim, chunk );
+      last  = std::min( ntasks, first + chunk );
+    }
+    if( first >= ntasks ) { exhausted_[victim] = 1; continue; }
+
+    // Fetch the claimed tasks
+    std::array<detail::XCTaskArena::extents_type,2> off;
+    MPI_Get( &off[0], sizeof(off[0]), MPI_BYTE, victim, first, sizeof(off[0]),
+      MPI_BYTE, offsets_win_ );
+    MPI_Get( &off[1], sizeof(off[1]), MPI_BYTE, victim, last, sizeof(off[1]),
+      MPI_BYTE, offsets_win_ );
+    MPI_Win_flush( victim, offsets_win_ );
+
+    detail::XCTaskArena::extents_type ext;
+    for( size_t k = 0; k < ext.size(); ++k ) ext[k] = off[1][k] - off[0][k];
+
+    detail::XCTaskArena stolen;
+    stolen.resize( ext );
+    size_t ibuf = 0;
+    stolen.for_each_typed_buffer( [&]( void* ptr, size_t elem_size, int iext ) {
+      auto win = buffer_wins_[ibuf++];
+      const size_t nbytes = elem_size * ext[iext];
+      if( !nbytes ) return;
+      if( nbytes > size_t(std::numeric_limits<int>::max()) )
+        GAUXC_GENERIC_EXCEPTION("Task Buffer Exceeds MPI Message Size");
+      MPI_Get( ptr, nbytes, MPI_BYTE, victim, off[0][iext], nbytes, MPI_BYTE,
+        win );
+      MPI_Win_flush( victim, win );
+    });
+
+    stolen.unpack( tasks );
+    if( range ) *range = { victim, size_t(first), size_t(last) };
+    return true;
+  }
+
+  return false;
+
+}
+
+}
+#endif
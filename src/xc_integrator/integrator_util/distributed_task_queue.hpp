@@ -0,0 +1,100 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/util/mpi.hpp>
+#include "xc_task_arena.hpp"
+
+#ifdef GAUXC_HAS_MPI
+namespace GauXC {
+
+/**
+ *  @brief Task queue over the local tasks of all ranks of a communicator
+ *  with inter-rank work stealing
+ *
+ *  Each rank exposes a counter of the next unstarted task of its (ordered)
+ *  local tasks together with the flattened tasks (XCTaskArena) through MPI 
+ *  windows. Tasks are claimed in chunks with an atomic fetch-and-add on the
+ *  counter of their owner: the owning rank claims guided chunks of its own
+ *  tasks, ranks which have run out of local tasks claim half of the 
+ *  remaining tasks of another rank and fetch them with MPI_Get. Every task
+ *  is processed exactly once.
+ *
+ *  Construction and destruction are collective. The queue may only be
+ *  accessed from one thread, the main thread within OpenMP parallel 
+ *  regions.
+ */
+class DistributedTaskQueue {
+
+  MPI_Comm comm_;
+  int      world_rank_;
+  int      world_size_;
+
+  detail::XCTaskArena                              arena_;
+  std::vector<detail::XCTaskArena::extents_type>   offsets_;
+  int64_t                                          next_task_;
+  int64_t                                          local_next_ = 0;
+  std::vector<int64_t>                             ntasks_;    ///< Per rank
+  std::vector<int>                                 exhausted_; ///< Per rank
+
+  MPI_Win              counter_win_;
+  MPI_Win              offsets_win_;
+  std::vector<MPI_Win> buffer_wins_;
+
+  int64_t read_counter_( int rank );
+  int64_t fetch_add_counter_( int rank, int64_t value );
+
+public:
+
+  /// Tasks [first, last) of rank taken by steal
+  struct stolen_range {
+    int    rank;
+    size_t first;
+    size_t last;
+  };
+
+  /// Construct the queue over the local tasks [begin, end) (collective)
+  template <typename TaskIt>
+  DistributedTaskQueue( TaskIt begin, TaskIt end, MPI_Comm comm ) :
+    DistributedTaskQueue( detail::XCTaskArena( begin, end ), comm ) { }
+
+  DistributedTaskQueue( detail::XCTaskArena&& arena, MPI_Comm comm );
+
+  DistributedTaskQueue( const DistributedTaskQueue& ) = delete;
+  DistributedTaskQueue( DistributedTaskQueue&& )      = delete;
+
+  /// Frees the MPI windows (collective)
+  ~DistributedTaskQueue() noexcept;
+
+  /**
+   *  Claim the next chunk [first, last) of the local tasks, a guided
+   *  fraction of the remaining local tasks with at least one task per 
+   *  OpenMP thread. Returns an empty range once the local tasks are 
+   *  exhausted.
+   */
+  std::pair<size_t,size_t> next_local();
+
+  /**
+   *  Steal unstarted tasks of another rank and append them to tasks, their
+   *  origin is returned in range if requested. Returns false if no rank has
+   *  unstarted tasks left.
+   */
+  bool steal( std::vector<XCTask>& tasks, stolen_range* range = nullptr );
+
+  /**
+   *  Drive MPI progress such that pending steals from other ranks are 
+   *  served by implementations without asynchronous progress. To be called
+   *  periodically while processing a chunk of local tasks, from any thread
+   *  of an OpenMP parallel region (only the main thread calls MPI).
+   */
+  void progress();
+
+};
+
+}
+#endif
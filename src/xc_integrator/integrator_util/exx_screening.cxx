@@ -7,6 +7,7 @@
  */
 #include "exx_screening.hpp"
 #include "host/blas.hpp"
+#include "integrator_common.hpp"
 #include <gauxc/util/div_ceil.hpp>
 #include <chrono>
 //#include <mpi.h>
@@ -38,8 +39,22 @@ void exx_ek_screening(
   const size_t nshells = basis.nshells();
   const size_t ntasks  = std::distance(task_begin, task_end);
 
+  // Number of tasks whose approximate F is formed concurrently. Bounds the
+  // dense intermediate to nbf * task_block_size
+  const size_t task_block_size = 256;
+
+  // Per-task basis function maxima are stored in CSR format over the
+  // bfn shell list of each task, i.e. memory scales with the total number
+  // of screened basis functions rather than nbf * ntasks
   std::vector<double> task_max_bf_sum(ntasks);
-  std::vector<double> task_max_bfn(nbf * ntasks);
+  std::vector<size_t> task_max_bfn_ptr(ntasks+1);
+  task_max_bfn_ptr[0] = 0;
+  for(size_t i_task = 0; i_task < ntasks; ++i_task) {
+    const auto& shell_list_bfn = (task_begin + i_task)->bfn_screening.shell_list;
+    task_max_bfn_ptr[i_task+1] = task_max_bfn_ptr[i_task] +
+      basis.nbf_subset( shell_list_bfn.begin(), shell_list_bfn.end() );
+  }
+  std::vector<double> task_max_bfn(task_max_bfn_ptr.back());
 
   //using hrt_t = std::chrono::high_resolution_clock;
   //using dur_t = std::chrono::duration<double>;
@@ -48,7 +63,6 @@ void exx_ek_screening(
   #pragma omp parallel
   { // Scope temp mem
   std::vector<double> basis_eval;
-  std::vector<double> bfn_max_grid(nbf);
 
   #pragma omp for schedule(dynamic)
   for(size_t i_task = 0; i_task < ntasks; ++i_task) {
@@ -65,7 +79,7 @@ void exx_ek_screening(
     int32_t* shell_list_bfn = shell_list_bfn_.data();
     size_t nshells_bfn = shell_list_bfn_.size();
     size_t nbe_bfn     = 
-      basis.nbf_subset( shell_list_bfn_.begin(), shell_list_bfn_.end() );
+      task_max_bfn_ptr[i_task+1] - task_max_bfn_ptr[i_task];
 
     // Resize scratch
     basis_eval.resize( nbe_bfn * npts );
@@ -87,8 +101,9 @@ void exx_ek_screening(
     }
     task_max_bf_sum[i_task] = max_bfn_sum;
 
-    // Compute max value for each bfn over grid
-    bfn_max_grid.resize(nbe_bfn);
+    // Compute max value for each bfn over grid (compressed over the bfn
+    // shell list of this task)
+    auto* bfn_max_grid = task_max_bfn.data() + task_max_bfn_ptr[i_task];
     for( auto ibf = 0ul; ibf < nbe_bfn; ++ibf ) {
       double tmp = 0.;
       for( auto ipt = 0ul; ipt < npts; ++ipt ) {
@@ -100,46 +115,83 @@ void exx_ek_screening(
       bfn_max_grid[ibf] = tmp;
     }
 
-    // Place max bfn into larger array
-    auto task_max_bfn_it = task_max_bfn.data() + i_task*nbf;
-    size_t ibf = 0ul;
-    for( auto i = 0ul; i < nshells_bfn; ++i ) {
-      const auto ish = shell_list_bfn[i];
-      const auto sh_sz = basis_map.shell_size(ish);
-      const auto sh_off = basis_map.shell_to_first_ao(ish);
-
-      for( auto j = 0; j < sh_sz; ++j ) {
-        task_max_bfn_it[j + sh_off] = bfn_max_grid[j + ibf];
-      }
-
-      ibf += sh_sz;
-    }
-
   } // Loop over tasks
   } // Memory Scope
   //auto coll_en = hrt_t::now();
   //std::cout << "... done " << dur_t(coll_en-coll_st).count() << std::endl;
 
-  // Compute approx F_i^(k) = |P_ij| * B_j^(k) 
-  //auto gemm_st = hrt_t::now();
-  std::vector<double> task_approx_f( nbf * ntasks );
-  blas::gemm( 'N', 'N', nbf, ntasks, nbf, 1., P_abs, ldp,
-    task_max_bfn.data(), nbf, 0., task_approx_f.data(), nbf );
-  //auto gemm_en = hrt_t::now();
-  //std::cout << "... done " << dur_t(gemm_en-gemm_st).count() << std::endl;
-
+  // Scratch for blocked sparse-dense products
+  std::vector<double>  task_approx_f( nbf * std::min(ntasks, task_block_size) );
+  std::vector<double>  block_max_bfn;
+  std::vector<int32_t> block_shell_mask(nshells);
+  std::vector<int32_t> block_shell_list;
+  std::vector<int32_t> block_shell_off(nshells);
 
   //std::ofstream fmax_file("cpu_fmax." + std::to_string(world_rank) + ".txt");
   //std::cout << "CPU FMAX SHELLS = ";
   //auto list_st = hrt_t::now();
+  for(size_t i_block = 0; i_block < ntasks; i_block += task_block_size) {
+
+  const size_t block_ntasks = std::min(task_block_size, ntasks - i_block);
+
+  // Union of the bfn shell lists over the tasks in this block
+  std::fill( block_shell_mask.begin(), block_shell_mask.end(), 0 );
+  for(size_t i_task = i_block; i_task < i_block + block_ntasks; ++i_task) 
+  for(auto ish : (task_begin + i_task)->bfn_screening.shell_list) {
+    block_shell_mask[ish] = 1;
+  }
+
+  block_shell_list.clear();
+  size_t block_nbe = 0;
+  for(size_t ish = 0; ish < nshells; ++ish) 
+  if( block_shell_mask[ish] ) {
+    block_shell_list.emplace_back(ish);
+    block_shell_off[ish] = block_nbe;
+    block_nbe += basis_map.shell_size(ish);
+  }
+
+  if( block_nbe ) {
+    // Unpack the CSR maxima into a dense (block_nbe x block_ntasks) panel
+    // B_max over the union shell list
+    block_max_bfn.assign( block_nbe * block_ntasks, 0. );
+    #pragma omp parallel for
+    for(size_t i_task = i_block; i_task < i_block + block_ntasks; ++i_task) {
+      const auto* bfn_max_grid = task_max_bfn.data() + task_max_bfn_ptr[i_task];
+      auto* B_col = block_max_bfn.data() + (i_task - i_block) * block_nbe;
+      size_t ibf = 0ul;
+      for(auto ish : (task_begin + i_task)->bfn_screening.shell_list) {
+        const auto sh_sz = basis_map.shell_size(ish);
+        std::copy_n( bfn_max_grid + ibf, sh_sz, B_col + block_shell_off[ish] );
+        ibf += sh_sz;
+      }
+    }
+
+    // Compute approx F_i^(k) = |P_ij| * B_j^(k) as a sum over the
+    // contiguous basis function ranges spanned by the union shell list
+    std::vector<std::array<int32_t,3>> block_submat_map;
+    std::tie( block_submat_map, std::ignore ) =
+      gen_compressed_submat_map( basis_map, block_shell_list, nbf, nbf );
+
+    double beta = 0.;
+    for( const auto& [bf_st, bf_sz, bf_off] : block_submat_map ) {
+      blas::gemm( 'N', 'N', nbf, block_ntasks, bf_sz, 1., 
+        P_abs + bf_st*ldp, ldp, block_max_bfn.data() + bf_off, block_nbe, 
+        beta, task_approx_f.data(), nbf );
+      beta = 1.;
+    }
+  } else {
+    std::fill_n( task_approx_f.begin(), nbf * block_ntasks, 0. );
+  }
+
   #pragma omp parallel for schedule(dynamic)
-  for(size_t i_task = 0; i_task < ntasks; ++i_task) {
+  for(size_t i_task = i_block; i_task < i_block + block_ntasks; ++i_task) {
     //std::cout << "ITASK = " << i_task << std::endl;
     std::vector<uint32_t> task_ek_shells(util::div_ceil(nshells,32),0);
     std::vector<double> max_F_shells(nshells);
 
     // Collapse max_F over shells
-    const double* max_F_approx_bfn = task_approx_f.data() + i_task*nbf;
+    const double* max_F_approx_bfn = 
+      task_approx_f.data() + (i_task - i_block)*nbf;
     for( auto ish = 0ul, ibf = 0ul; ish < nshells; ++ish) {
       const auto sh_sz = basis[ish].size();
       double tmp = 0.;
@@ -209,6 +261,7 @@ void exx_ek_screening(
       basis.nbf_subset( ek_shells.begin(), ek_shells.end() );
 
   } // Loop over tasks
+  } // Loop over task blocks
   //auto list_en = hrt_t::now();
   //std::cout << "... done " << dur_t(list_en-list_st).count() << std::endl;
 
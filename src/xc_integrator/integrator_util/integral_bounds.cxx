@@ -7,6 +7,7 @@
  */
 #include "integral_bounds.hpp"
 #include <vector>
+#include <cmath>
 #include <gauxc/util/geometry.hpp>
 #include <gauxc/util/constexpr_math.hpp>
 #include <gauxc/exceptions.hpp>
@@ -68,6 +69,33 @@ inline constexpr double max_coulomb_44( double Rab, double alpha, double beta,
   );
 }
 
+// Bound for arbitrary angular momenta: with |x_A^a| <= (|r-P| + |PA|)^l_a,
+// the potential of the resulting spherical distribution about P is
+// maximal at P, which yields
+//   sum_ij binom(l_a,i) binom(l_b,j) PA^i PB^j Gamma(n/2+1) / gamma^(n/2),
+//   n = l_a + l_b - i - j
+inline double max_coulomb_generic( int l_a, int l_b, double Rab, double alpha, 
+  double beta, double gamma ) {
+
+  const double Rab_sqrt = std::sqrt(Rab);
+  const double PA = beta  / gamma * Rab_sqrt;
+  const double PB = alpha / gamma * Rab_sqrt;
+
+  double V = 0.;
+  double binom_i = 1.;
+  for( int i = 0; i <= l_a; ++i ) {
+    double binom_j = 1.;
+    for( int j = 0; j <= l_b; ++j ) {
+      const double n = l_a + l_b - i - j;
+      V += binom_i * binom_j * std::pow(PA,i) * std::pow(PB,j) *
+        std::tgamma(0.5*n + 1.) * std::pow(gamma, -0.5*n);
+      binom_j = binom_j * (l_b - j) / (j + 1);
+    }
+    binom_i = binom_i * (l_a - i) / (i + 1);
+  }
+
+  return V;
+}
 
 inline double max_coulomb( int l_a, int l_b, double Rab, double alpha, 
   double beta, double gamma ) {
@@ -88,7 +116,8 @@ inline double max_coulomb( int l_a, int l_b, double Rab, double alpha,
   const int l_a_m = l_a - (l_a % 2);
   const int l_b_m = l_b - (l_b % 2);
 
-  if( l_a_p > 4 or l_b_p > 4 ) GAUXC_GENERIC_EXCEPTION("Case Not Handled"); 
+  if( l_a_p > 4 or l_b_p > 4 ) 
+    return max_coulomb_generic( l_a, l_b, Rab, alpha, beta, gamma );
 
   double V_pm = std::numeric_limits<double>::infinity();
   if( l_a_p == 0 and l_b_m == 0 ) 
@@ -0,0 +1,160 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "task_ordering.hpp"
+#include <limits>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace GauXC {
+
+namespace {
+
+constexpr int sfc_bits = 21; // Bits per dimension
+
+// Interleave the bits of X (X[0] most significant)
+uint64_t interleave_bits( const std::array<uint32_t,3>& X ) {
+  uint64_t key = 0;
+  for( int b = sfc_bits-1; b >= 0; --b )
+  for( int i = 0; i < 3; ++i ) key = (key << 1) | ((X[i] >> b) & 1u);
+  return key;
+}
+
+// Hilbert index in transposed form, J. Skilling, "Programming the Hilbert
+// curve", AIP Conf. Proc. 707, 381 (2004)
+uint64_t hilbert_key( std::array<uint32_t,3> X ) {
+
+  const uint32_t M = 1u << (sfc_bits - 1);
+
+  // Inverse undo
+  for( uint32_t Q = M; Q > 1; Q >>= 1 ) {
+    const uint32_t P = Q - 1;
+    for( int i = 0; i < 3; ++i ) 
+    if( X[i] & Q ) X[0] ^= P;
+    else {
+      const uint32_t t = (X[0] ^ X[i]) & P;
+      X[0] ^= t; X[i] ^= t;
+    }
+  }
+
+  // Gray encode
+  for( int i = 1; i < 3; ++i ) X[i] ^= X[i-1];
+  uint32_t t = 0;
+  for( uint32_t Q = M; Q > 1; Q >>= 1 ) if( X[2] & Q ) t ^= Q - 1;
+  for( int i = 0; i < 3; ++i ) X[i] ^= t;
+
+  return interleave_bits( X );
+
+}
+
+}
+
+std::vector<uint64_t> space_filling_curve_keys( 
+  const std::vector<std::array<double,3>>& points, TaskOrdering ordering ) {
+
+  if( ordering == TaskOrdering::Size )
+    GAUXC_GENERIC_EXCEPTION("TaskOrdering::Size Is Not a Space Filling Curve");
+
+  constexpr auto inf = std::numeric_limits<double>::infinity();
+  std::array<double,3> lo = {inf, inf, inf}, up = {-inf, -inf, -inf};
+  for( const auto& p : points )
+  for( int k = 0; k < 3; ++k ) {
+    lo[k] = std::min( lo[k], p[k] );
+    up[k] = std::max( up[k], p[k] );
+  }
+
+  // Quantize on a cubic grid to preserve the aspect ratio
+  double extent = 0.;
+  for( int k = 0; k < 3; ++k ) extent = std::max( extent, up[k] - lo[k] );
+  const double nmax  = double((1u << sfc_bits) - 1);
+  const double scale = extent > 0. ? nmax / extent : 0.;
+
+  std::vector<uint64_t> keys( points.size() );
+  for( size_t i = 0; i < points.size(); ++i ) {
+    std::array<uint32_t,3> X;
+    for( int k = 0; k < 3; ++k ) 
+      X[k] = std::min( nmax, (points[i][k] - lo[k]) * scale );
+    keys[i] = ordering == TaskOrdering::Hilbert ? 
+      hilbert_key( X ) : interleave_bits( X );
+  }
+
+  return keys;
+
+}
+
+
+TaskScheduler::TaskScheduler( const std::vector<size_t>& task_cost, 
+  bool locality ) {
+
+  const uint64_t ntasks = task_cost.size();
+  if( ntasks >= (1ul << 32) ) GAUXC_GENERIC_EXCEPTION("Too Many Tasks");
+
+  nranges_ = 1;
+#ifdef _OPENMP
+  if( locality ) nranges_ = omp_get_max_threads();
+#endif
+  ranges_ = std::make_unique<task_range[]>( nranges_ );
+
+  // Contiguous ranges of equal cost
+  const size_t total = std::accumulate( task_cost.begin(), task_cost.end(), 0ul );
+  size_t acc = 0;
+  uint64_t iT = 0;
+  for( size_t ir = 0; ir < nranges_; ++ir ) {
+    const auto first = iT;
+    const double target = double(total) * (ir + 1) / nranges_;
+    while( iT < ntasks and 
+           (ir == nranges_-1 or acc + 0.5 * task_cost[iT] < target) ) 
+      acc += task_cost[iT++];
+    ranges_[ir].range = (first << 32) | iT;
+  }
+
+}
+
+int64_t TaskScheduler::next() {
+
+  size_t tid = 0;
+#ifdef _OPENMP
+  tid = omp_get_thread_num() % nranges_;
+#endif
+
+  constexpr uint64_t mask = (1ul << 32) - 1;
+  auto& own = ranges_[tid].range;
+
+  // Next task of the own range
+  auto r = own.load();
+  while( (r >> 32) < (r & mask) ) 
+    if( own.compare_exchange_weak( r, r + (1ul << 32) ) ) return r >> 32;
+
+  // Steal the back half of the largest remaining range
+  while( true ) {
+
+    uint64_t max_rem = 0; size_t victim = 0;
+    for( size_t ir = 0; ir < nranges_; ++ir ) {
+      const auto rv = ranges_[ir].range.load(std::memory_order_relaxed);
+      const auto rem = (rv & mask) - std::min( rv >> 32, rv & mask );
+      if( rem > max_rem ) { max_rem = rem; victim = ir; }
+    }
+    if( not max_rem ) return -1;
+
+    auto rv = ranges_[victim].range.load();
+    const auto first = rv >> 32, last = rv & mask;
+    if( first >= last ) continue;
+
+    const auto take = (last - first + 1) / 2;
+    if( ranges_[victim].range.compare_exchange_weak( rv, 
+      (first << 32) | (last - take) ) ) {
+      const auto iT = last - take;
+      own.store( ((iT + 1) << 32) | last );
+      return iT;
+    }
+
+  }
+
+}
+
+}
@@ -0,0 +1,78 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/enums.hpp>
+#include <gauxc/xc_task.hpp>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <numeric>
+
+namespace GauXC {
+
+/// Keys of points along a Morton / Hilbert curve over their bounding box
+std::vector<uint64_t> space_filling_curve_keys( 
+  const std::vector<std::array<double,3>>& points, TaskOrdering ordering );
+
+/// Order of tasks along a space filling curve through their centroids, 
+/// the i-th task of the order is task perm[i] (stable)
+template <typename TaskIterator>
+std::vector<size_t> space_filling_curve_order( TaskIterator begin, 
+  TaskIterator end, TaskOrdering ordering ) {
+
+  const size_t ntasks = std::distance( begin, end );
+  std::vector<std::array<double,3>> centroids( ntasks, {0., 0., 0.} );
+  for( size_t iT = 0; iT < ntasks; ++iT ) {
+    const auto& points = (begin + iT)->points;
+    for( const auto& pt : points )
+    for( int k = 0; k < 3; ++k ) centroids[iT][k] += pt[k];
+    if( points.size() ) 
+      for( int k = 0; k < 3; ++k ) centroids[iT][k] /= points.size();
+  }
+
+  const auto keys = space_filling_curve_keys( centroids, ordering );
+  std::vector<size_t> perm( ntasks );
+  std::iota( perm.begin(), perm.end(), 0 );
+  std::stable_sort( perm.begin(), perm.end(), 
+    [&]( auto i, auto j ){ return keys[i] < keys[j]; } );
+
+  return perm;
+
+}
+
+/**
+ *  @brief Locality-aware dynamic scheduler over an ordered list of tasks
+ *
+ *  The tasks are split into one contiguous range of (estimated) equal cost
+ *  per thread. Each thread walks its own range in order and, once it is
+ *  exhausted, steals the back half of the largest remaining range. With a
+ *  single range this reduces to schedule(dynamic).
+ */
+class TaskScheduler {
+
+  /// Task range [first, last) packed as (first << 32) | last
+  struct alignas(64) task_range {
+    std::atomic<uint64_t> range;
+  };
+
+  size_t nranges_;
+  std::unique_ptr<task_range[]> ranges_;
+
+public:
+
+  /// Construct a scheduler over tasks of given costs, one range per OpenMP
+  /// thread if locality is requested, a single range otherwise
+  TaskScheduler( const std::vector<size_t>& task_cost, bool locality );
+
+  /// Index of the next task for the calling thread, -1 if none remain
+  int64_t next();
+
+};
+
+}
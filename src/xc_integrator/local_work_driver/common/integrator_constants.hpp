@@ -15,5 +15,16 @@ constexpr F magic_ssf_factor = 0.64;
 
 constexpr double ssf_weight_tol = 1e-10;
 
+/// Screening of the Becke cell functions: atoms beyond becke_neighbor_ratio
+/// times the distance of the nearest atom to a point are neglected, and
+/// cell functions are truncated once below becke_weight_tol times the
+/// largest cell function of the point evaluated before. The cell
+/// function of a neglected atom is below ~1e-12 (mu >= 79/81 to the nearest
+/// atom, s(mu) ~ 1.5^7 (1-mu)^8 / 2), hence each neglected atom or truncated
+/// cell function perturbs the partition weights by at most ~1e-12
+/// (relative), ~natoms * 1e-12 in total
+constexpr double becke_neighbor_ratio = 80.;
+constexpr double becke_weight_tol     = 1e-12;
+
 }
 }
@@ -30,10 +30,21 @@ LocalHostWorkDriver::LocalHostWorkDriver( LocalHostWorkDriver&& other ) noexcept
 // Partition weights
 void LocalHostWorkDriver::partition_weights( XCWeightAlg weight_alg, 
   const Molecule& mol, const MolMeta& meta, task_iterator task_begin, 
-  task_iterator task_end ) {
+  task_iterator task_end, bool neighbor_list ) {
 
   throw_if_invalid_pimpl(pimpl_);
-  pimpl_->partition_weights(weight_alg, mol, meta, task_begin, task_end);
+  pimpl_->partition_weights(weight_alg, mol, meta, task_begin, task_end,
+    neighbor_list);
+
+}
+
+void LocalHostWorkDriver::partition_weights_gradient( XCWeightAlg weight_alg,
+  const Molecule& mol, const MolMeta& meta, const_task_iterator task_begin,
+  const_task_iterator task_end, const double* f, double* GRAD ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->partition_weights_gradient(weight_alg, mol, meta, task_begin, 
+    task_end, f, GRAD);
 
 }
 
@@ -124,16 +135,40 @@ void LocalHostWorkDriver::eval_exx_fmat( size_t npts, size_t nbf, size_t nbe_bra
 
 
 // G Matrix G(mu,i) = w(i) * A(mu,nu,i) * X(mu,i)
+void LocalHostWorkDriver::setup_shell_pair_engines( 
+  const RuntimeEnvironment& rt ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->setup_shell_pair_engines(rt);
+
+}
+
 void LocalHostWorkDriver::eval_exx_gmat( size_t npts, size_t nshells, 
   size_t nshell_pairs, size_t nbe, const double* points, const double* weights, 
   const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
   const BasisSetMap& basis_map, const int32_t* shell_list, 
   const std::pair<int32_t,int32_t>* shell_pair_list, 
-  const double* X, size_t ldx, double* G, size_t ldg ) {;
+  const double* X, size_t ldx, double* G, size_t ldg, double mp_tol,
+  ShellPairIntegralEngine engine, double alpha, double beta, double omega ) {
 
   throw_if_invalid_pimpl(pimpl_);
   pimpl_->eval_exx_gmat(npts, nshells, nshell_pairs, nbe, points, weights, 
-    basis, shpairs, basis_map, shell_list, shell_pair_list, X, ldx, G, ldg );
+    basis, shpairs, basis_map, shell_list, shell_pair_list, X, ldx, G, ldg,
+    mp_tol, engine, alpha, beta, omega );
+
+}
+
+// J(mu,nu) += w(i) * rho(i) * A(mu,nu,i)
+void LocalHostWorkDriver::inc_coulomb_j( size_t npts, size_t nshell_pairs,
+    const double* points, const double* weights, const double* den,
+    const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
+    const BasisSetMap& basis_map, 
+    const std::pair<int32_t,int32_t>* shell_pair_list, 
+    double* J, size_t ldj, double mp_tol ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->inc_coulomb_j(npts, nshell_pairs, points, weights, den, basis,
+    shpairs, basis_map, shell_pair_list, J, ldj, mp_tol);
 
 }
 
@@ -14,6 +14,7 @@
 #include <gauxc/shell_pair.hpp>
 #include <gauxc/basisset_map.hpp>
 #include <gauxc/xc_task.hpp>
+#include <gauxc/runtime_environment.hpp>
 
 
 namespace GauXC {
@@ -33,6 +34,7 @@ public:
   using submat_map_t = std::vector< std::array<int32_t,3> >;
   using task_container = std::vector<XCTask>;
   using task_iterator  = typename task_container::iterator;
+  using const_task_iterator = typename task_container::const_iterator;
 
   /// Construct LocalHostWorkDriver instance in invalid state
   LocalHostWorkDriver();
@@ -67,9 +69,34 @@ public:
    *
    *  @param[in/out] task_begin Start iterator for task container to be modified
    *  @param[in/out] task_end   End iterator for task container to be modified
+   *
+   *  @param[in] neighbor_list Whether to screen the Becke / SSF partition
+   *                           functions with interatomic neighbor lists
    */
   void partition_weights( XCWeightAlg weight_alg, const Molecule& mol, 
-    const MolMeta& meta, task_iterator task_begin, task_iterator task_end );
+    const MolMeta& meta, task_iterator task_begin, task_iterator task_end,
+    bool neighbor_list = false );
+
+  /** Evaluate the partition weight derivative contributions to a gradient
+   *
+   *  Increments GRAD with sum_p w_p f_p dW(p)/dR, W being the partition
+   *  weight of p, with the quadrature points moving along with their parent
+   *  atoms. The Becke / SSF partition functions are screened with
+   *  interatomic neighbor lists.
+   *
+   *  @param[in] weight_alg Molecular partitioning scheme (Becke or SSF)
+   *  @param[in] mol        Molecule being partitioned
+   *  @param[in] molmeta    Metadata associated with mol
+   *
+   *  @param[in] task_begin Start iterator for the partitioned tasks
+   *  @param[in] task_end   End iterator for the partitioned tasks
+   *
+   *  @param[in] f          Integrand at the task points, packed in task order
+   *  @param[in/out] GRAD   Gradient (3 x natoms) to be incremented
+   */
+  void partition_weights_gradient( XCWeightAlg weight_alg, const Molecule& mol,
+    const MolMeta& meta, const_task_iterator task_begin, 
+    const_task_iterator task_end, const double* f, double* GRAD );
 
 
   /** Evaluation the collocation matrix
@@ -202,17 +229,54 @@ public:
     const double* basis_eval, size_t ldb, double* F, size_t ldf,
     double* scr );
 
+  /** Select the shell pair integral engines of ShellPairIntegralEngine::Auto
+   *
+   *  Benchmarked on rank 0 of rt and broadcast, collective over rt on the
+   *  first call. To be called outside of OpenMP parallel regions before 
+   *  eval_exx_gmat, which otherwise uses Obara-Saika for Auto
+   *
+   *  @param[in] rt  Runtime environment of the calling ranks
+   */
+  void setup_shell_pair_engines( const RuntimeEnvironment& rt );
+
   void eval_exx_gmat( size_t npts, size_t nshells, size_t nshell_pairs,
     size_t nbe, const double* points, const double* weights, 
     const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
     const BasisSetMap& basis_map, const int32_t* shell_list, 
     const std::pair<int32_t,int32_t>* shell_pair_list, 
-    const double* X, size_t ldx, double* G, size_t ldg );
+    const double* X, size_t ldx, double* G, size_t ldg, double mp_tol,
+    ShellPairIntegralEngine engine, double alpha, double beta, double omega );
 
   void inc_exx_k( size_t npts, size_t nbf, size_t nbe_bra, size_t nbe_ket, 
     const double* basis_eval, const submat_map_t& submat_map_bra, 
     const submat_map_t& submat_map_ket, const double* G, size_t ldg, double* K, 
     size_t ldk, double* scr );
+
+  /** Increment the Coulomb matrix with the contribution of a grid density
+   *
+   *  J(mu,nu) += sum_i w(i) * rho(i) * A(mu,nu,i)
+   *
+   *  Both J(mu,nu) and J(nu,mu) blocks are incremented for each shell pair
+   *
+   *  @param[in]  npts            The number of points
+   *  @param[in]  nshell_pairs    The number of shell pairs to evaluate
+   *  @param[in]  points          The grid points ( (3,npts) col major)
+   *  @param[in]  weights         The quadrature weights
+   *  @param[in]  den             The density evaluated on the grid
+   *  @param[in]  basis           The basis set
+   *  @param[in]  shpairs         Shell pair data for the basis set
+   *  @param[in]  basis_map       Basis map for the basis set
+   *  @param[in]  shell_pair_list List of shell pairs (i,j) with i >= j
+   *  @param[in/out] J            The Coulomb matrix ( (nbf,nbf) col major)
+   *  @param[in]  ldj             The leading dimension of J
+   *  @param[in]  mp_tol          Far-field multipole tolerance (0 disables)
+   */
+  void inc_coulomb_j( size_t npts, size_t nshell_pairs,
+    const double* points, const double* weights, const double* den,
+    const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
+    const BasisSetMap& basis_map, 
+    const std::pair<int32_t,int32_t>* shell_pair_list, 
+    double* J, size_t ldj, double mp_tol );
     
   /** Evaluate the U and V variavles for RKS LDA
    *
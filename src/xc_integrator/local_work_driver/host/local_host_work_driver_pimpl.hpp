@@ -16,6 +16,7 @@ struct LocalHostWorkDriverPIMPL {
   using submat_map_t   = LocalHostWorkDriver::submat_map_t;
   using task_container = LocalHostWorkDriver::task_container;
   using task_iterator  = LocalHostWorkDriver::task_iterator;
+  using const_task_iterator = LocalHostWorkDriver::const_task_iterator;
 
   LocalHostWorkDriverPIMPL();
 
@@ -28,7 +29,11 @@ struct LocalHostWorkDriverPIMPL {
   // Public APIs
 
   virtual void partition_weights( XCWeightAlg weight_alg, const Molecule& mol, 
-    const MolMeta& meta, task_iterator task_begin, task_iterator task_end ) = 0;
+    const MolMeta& meta, task_iterator task_begin, task_iterator task_end,
+    bool neighbor_list ) = 0;
+  virtual void partition_weights_gradient( XCWeightAlg weight_alg, 
+    const Molecule& mol, const MolMeta& meta, const_task_iterator task_begin, 
+    const_task_iterator task_end, const double* f, double* GRAD ) = 0;
 
   virtual void eval_collocation( size_t npts, size_t nshells, size_t nbe, 
     const double* pts, const BasisSet<double>& basis, const int32_t* shell_list, 
@@ -63,17 +68,27 @@ struct LocalHostWorkDriverPIMPL {
     const double* basis_eval, size_t ldb, double* F, size_t ldf,
     double* scr ) = 0;
 
+  virtual void setup_shell_pair_engines( const RuntimeEnvironment& rt ) = 0;
+
   virtual void eval_exx_gmat( size_t npts, size_t nshells, size_t nshell_pairs,
     size_t nbe, const double* points, const double* weights, 
     const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
     const BasisSetMap& basis_map, const int32_t* shell_list, 
     const std::pair<int32_t,int32_t>* shell_pair_list, 
-    const double* X, size_t ldx, double* G, size_t ldg ) = 0;
+    const double* X, size_t ldx, double* G, size_t ldg, double mp_tol,
+    ShellPairIntegralEngine engine, double alpha, double beta, double omega ) = 0;
 
   virtual void inc_exx_k( size_t npts, size_t nbf, size_t nbe_bra, size_t nbe_ket, 
     const double* basis_eval, const submat_map_t& submat_map_bra, 
     const submat_map_t& submat_map_ket, const double* G, size_t ldg, double* K, 
     size_t ldk, double* scr ) = 0;
+
+  virtual void inc_coulomb_j( size_t npts, size_t nshell_pairs,
+    const double* points, const double* weights, const double* den,
+    const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
+    const BasisSetMap& basis_map, 
+    const std::pair<int32_t,int32_t>* shell_pair_list, 
+    double* J, size_t ldj, double mp_tol ) = 0;
     
   virtual void eval_uvvar_lda_rks( size_t npts, size_t nbe, const double* basis_eval,
     const double* X, size_t ldx, double* den_eval) = 0;
@@ -26,4 +26,44 @@ void compute_integral_shell_pair(int is_diag,
                   int ldG, 
                   double *weights, 
                   double *boys_table);
+
+// Potential integrals V(a*ncart_b+b, i) = (a|1/|r-C_i||b) of a shell pair
+// for arbitrary angular momenta (lA >= lB, ordering of generate_shell_pair)
+//
+// The range-separated operator (alpha + beta * erf(omega*r)) / r is
+// evaluated for omega > 0
+void compute_potential_shell_pair( size_t npts,
+                  const double *points,
+                  int lA,
+                  int lB,
+                  point rA,
+                  point rB,
+                  int nprim_pairs,
+                  const prim_pair *prim_pairs,
+                  double *V,
+                  size_t ldV,
+                  double *boys_table,
+                  double alpha = 1.,
+                  double beta  = 0.,
+                  double omega = 0. );
+
+// Same contract as compute_integral_shell_pair for arbitrary angular
+// momenta, used for the classes without generated kernels (l > 4)
+void compute_integral_shell_pair_generic( int is_diag,
+                  size_t npts,
+                  const double *points,
+                  int lA,
+                  int lB,
+                  point rA,
+                  point rB,
+                  int nprim_pairs,
+                  const prim_pair *prim_pairs,
+                  const double *Xi,
+                  const double *Xj,
+                  int ldX,
+                  double *Gi,
+                  double *Gj,
+                  int ldG,
+                  const double *weights,
+                  double *boys_table );
 }
@@ -12,7 +12,7 @@
 #define NPTS_LOCAL 64
 
 #define DEFAULT_NCHEB  7
-#define DEFAULT_MAX_M  8
+#define DEFAULT_MAX_M 12
 #define DEFAULT_MAX_T 30
 
 #define DEFAULT_NSEGMENT ((DEFAULT_MAX_T * DEFAULT_NCHEB) / 2)
@@ -157,7 +157,9 @@ void compute_integral_shell_pair(int is_diag,
                    weights, 
                    boys_table);
       } else {
-         printf("Type not defined!\n");
+         compute_integral_shell_pair_generic(is_diag, npts, points, lA, lA,
+                   rA, rB, nprim_pairs, prim_pairs, Xi, Xi, ldX, Gi, Gi, ldG,
+                   weights, boys_table);
       }
    } else {
       if((lA == 0) && (lB == 0)) {
@@ -536,7 +538,9 @@ void compute_integral_shell_pair(int is_diag,
                      weights, 
                      boys_table);
       } else {
-         printf("Type not defined!\n");
+         compute_integral_shell_pair_generic(is_diag, npts, points, lA, lB,
+                   rA, rB, nprim_pairs, prim_pairs, Xi, Xj, ldX, Gi, Gj, ldG,
+                   weights, boys_table);
       }
    }
 }
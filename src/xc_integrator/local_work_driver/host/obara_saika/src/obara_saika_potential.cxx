@@ -0,0 +1,285 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "../include/cpu/integral_data_types.hpp"
+#include "../include/cpu/obara_saika_integrals.hpp"
+#include "config_obara_saika.hpp"
+
+namespace XCPU {
+
+namespace {
+
+  inline int ncart( int l ) { return (l+1)*(l+2)/2; }
+
+  // Offset of the first component of angular momentum l in a packed
+  // list of all Cartesian components with angular momentum 0..l-1
+  inline int cart_offset( int l ) { return l*(l+1)*(l+2)/6; }
+
+  // Same ordering as the generated kernels (x descending, z ascending)
+  inline int cart_index( int ax, int az, int l ) {
+    return (l-ax)*(l-ax+1)/2 + az;
+  }
+
+  // Boys function F_m(T) for m = 0..mmax
+  //   Chebyshev interpolation of F_mmax followed by downward recursion
+  //   F_m = (2T F_m+1 + exp(-T)) / (2m+1) for T < DEFAULT_MAX_T,
+  //   asymptotic expansion otherwise
+  void boys_function( int mmax, double T, double* F, const double* boys_table ) {
+
+    if( T < DEFAULT_MAX_T ) {
+
+      if( mmax == 0 ) { F[0] = boys_element_0(T); return; }
+
+      const double* boys_m = boys_table + mmax * DEFAULT_LD_TABLE * DEFAULT_NSEGMENT;
+      constexpr double deltaT = double(DEFAULT_MAX_T) / DEFAULT_NSEGMENT;
+      constexpr double one_over_deltaT = 1 / deltaT;
+
+      const int iseg = std::floor(T * one_over_deltaT);
+      const double* boys_seg = boys_m + iseg * DEFAULT_LD_TABLE;
+
+      const double xt = T * (2.0 / deltaT) - (2 * iseg + 1);
+      double _rec = 1.0;
+      double _val = boys_seg[0];
+      for( int i = 1; i < DEFAULT_NCHEB + 1; ++i ) {
+        _rec *= xt;
+        _val += _rec * boys_seg[i];
+      }
+      F[mmax] = _val;
+
+      const double exp_t = std::exp(-T);
+      for( int m = mmax-1; m >= 0; --m )
+        F[m] = (2. * T * F[m+1] + exp_t) / (2*m + 1);
+
+    } else {
+
+      const double t_inv = 1. / T;
+      F[0] = GauXC::constants::sqrt_pi_ov_2<> * GauXC::rsqrt(T);
+      for( int m = 1; m <= mmax; ++m ) F[m] = F[m-1] * (m - 0.5) * t_inv;
+
+    }
+
+  }
+
+  // Boys function of the operator (alpha + beta * erf(omega*r)) / r
+  //   alpha F_m(T) + beta sqrt(kappa) kappa^m F_m(kappa T), 
+  //   kappa = omega^2 / (omega^2 + gamma)
+  void attenuated_boys_function( int mmax, double T, double gamma, 
+    double alpha, double beta, double omega, double* F, double* F_scr,
+    const double* boys_table ) {
+
+    boys_function( mmax, T, F, boys_table );
+    for( int m = 0; m <= mmax; ++m ) F[m] *= alpha;
+
+    const double omega_sq = omega * omega;
+    const double kappa = omega_sq / (omega_sq + gamma);
+    boys_function( mmax, kappa * T, F_scr, boys_table );
+
+    double fac = beta * std::sqrt(kappa);
+    for( int m = 0; m <= mmax; ++m ) {
+      F[m] += fac * F_scr[m];
+      fac  *= kappa;
+    }
+
+  }
+
+}
+
+void compute_potential_shell_pair( size_t npts,
+                  const double *points,
+                  int lA,
+                  int lB,
+                  point rA,
+                  point rB,
+                  int nprim_pairs,
+                  const prim_pair *prim_pairs,
+                  double *V,
+                  size_t ldV,
+                  double *boys_table,
+                  double alpha,
+                  double beta,
+                  double omega ) {
+
+  const int L   = lA + lB;
+  const int ncA = ncart(lA);
+  const int ncB = ncart(lB);
+  const int nm  = L + 1;
+
+  const double ABx = rA.x - rB.x;
+  const double ABy = rA.y - rB.y;
+  const double ABz = rA.z - rB.z;
+
+  // [e|0]^(m) for |e| = 0..L, m = 0..L-|e| (VRR)
+  std::vector<double> vrr( cart_offset(L+1) * nm );
+  // Primitive contracted [e|0]^(0) for |e| = lA..L
+  const int nacc = cart_offset(L+1) - cart_offset(lA);
+  std::vector<double> acc( nacc );
+  // [a|b] for |a| = lA..L-|b| (HRR)
+  std::vector<double> hrr_cur( nacc * ncB ), hrr_prev( nacc * ncB );
+  std::vector<double> F( nm ), F_scr( nm );
+  const bool attenuated = omega > 0.;
+
+  const double* X = points;
+  const double* Y = points + npts;
+  const double* Z = points + 2*npts;
+
+  for( size_t ipt = 0; ipt < npts; ++ipt ) {
+
+    std::fill( acc.begin(), acc.end(), 0. );
+
+    for( int ij = 0; ij < nprim_pairs; ++ij ) {
+
+      const auto& pp = prim_pairs[ij];
+      const double PC[3] = { pp.P.x - X[ipt], pp.P.y - Y[ipt], pp.P.z - Z[ipt] };
+      const double PA[3] = { pp.PA.x, pp.PA.y, pp.PA.z };
+      const double T = pp.gamma * (PC[0]*PC[0] + PC[1]*PC[1] + PC[2]*PC[2]);
+
+      if( attenuated )
+        attenuated_boys_function( L, T, pp.gamma, alpha, beta, omega, 
+          F.data(), F_scr.data(), boys_table );
+      else {
+        boys_function( L, T, F.data(), boys_table );
+        if( alpha != 1. ) for( int m = 0; m < nm; ++m ) F[m] *= alpha;
+      }
+      for( int m = 0; m < nm; ++m ) vrr[m] = pp.K_coeff_prod * F[m];
+
+      // [e|0]^(m) = PA_i [e-1_i]^(m) - PC_i [e-1_i]^(m+1) +
+      //   (e_i-1)/2g ([e-2_i]^(m) - [e-2_i]^(m+1))
+      const double oo2g = 0.5 * pp.gamma_inv;
+      for( int l = 1; l <= L; ++l )
+      for( int ax = l, ie = 0; ax >= 0; --ax )
+      for( int az = 0; az <= l - ax; ++az, ++ie ) {
+        const int ay = l - ax - az;
+
+        // Recurse along the first non-zero direction
+        const int dir = ax ? 0 : (ay ? 1 : 2);
+        const int e_i = dir == 0 ? ax : (dir == 1 ? ay : az);
+
+        const int e1 = cart_offset(l-1) +
+          cart_index( ax - (dir==0), az - (dir==2), l-1 );
+        const double* v1 = vrr.data() + e1 * nm;
+        double* v = vrr.data() + (cart_offset(l) + ie) * nm;
+
+        for( int m = 0; m <= L - l; ++m )
+          v[m] = PA[dir] * v1[m] - PC[dir] * v1[m+1];
+
+        if( e_i > 1 ) {
+          const int e2 = cart_offset(l-2) +
+            cart_index( ax - 2*(dir==0), az - 2*(dir==2), l-2 );
+          const double* v2 = vrr.data() + e2 * nm;
+          const double fac = (e_i - 1) * oo2g;
+          for( int m = 0; m <= L - l; ++m )
+            v[m] += fac * (v2[m] - v2[m+1]);
+        }
+      }
+
+      for( int e = 0; e < nacc; ++e )
+        acc[e] += vrr[(cart_offset(lA) + e) * nm];
+
+    } // Loop over primitive pairs
+
+    // [a|b+1_i] = [a+1_i|b] + AB_i [a|b]
+    for( int e = 0; e < nacc; ++e ) hrr_prev[e] = acc[e];
+    for( int lb = 1; lb <= lB; ++lb ) {
+      const int ncb      = ncart(lb);
+      const int ncb_prev = ncart(lb-1);
+      for( int la = lA; la <= L - lb; ++la )
+      for( int ax = la, ia = 0; ax >= 0; --ax )
+      for( int az = 0; az <= la - ax; ++az, ++ia ) {
+        const int a_off  = cart_offset(la) - cart_offset(lA) + ia;
+        for( int bx = lb, ib = 0; bx >= 0; --bx )
+        for( int bz = 0; bz <= lb - bx; ++bz, ++ib ) {
+          const int by  = lb - bx - bz;
+          const int dir = bx ? 0 : (by ? 1 : 2);
+          const double AB_i = dir == 0 ? ABx : (dir == 1 ? ABy : ABz);
+
+          const int b1 = cart_index( bx - (dir==0), bz - (dir==2), lb-1 );
+          const int a1 = cart_offset(la+1) - cart_offset(lA) +
+            cart_index( ax + (dir==0), az + (dir==2), la+1 );
+
+          hrr_cur[a_off * ncb + ib] = hrr_prev[a1 * ncb_prev + b1] +
+            AB_i * hrr_prev[a_off * ncb_prev + b1];
+        }
+      }
+      std::swap( hrr_cur, hrr_prev );
+    }
+
+    for( int a = 0; a < ncA; ++a )
+    for( int b = 0; b < ncB; ++b )
+      V[(a*ncB + b)*ldV + ipt] = hrr_prev[a*ncB + b];
+
+  } // Loop over points
+
+}
+
+void compute_integral_shell_pair_generic( int is_diag,
+                  size_t npts,
+                  const double *points,
+                  int lA,
+                  int lB,
+                  point rA,
+                  point rB,
+                  int nprim_pairs,
+                  const prim_pair *prim_pairs,
+                  const double *Xi,
+                  const double *Xj,
+                  int ldX,
+                  double *Gi,
+                  double *Gj,
+                  int ldG,
+                  const double *weights,
+                  double *boys_table ) {
+
+  // Integrals are generated with the higher-l shell first
+  const bool swap = lA < lB;
+  const int la = swap ? lB : lA;
+  const int lb = swap ? lA : lB;
+  const point ra = swap ? rB : rA;
+  const point rb = swap ? rA : rB;
+  const double* Xa = swap ? Xj : Xi;
+  const double* Xb = swap ? Xi : Xj;
+  double* Ga = swap ? Gj : Gi;
+  double* Gb = swap ? Gi : Gj;
+
+  // Diagonal pairs only reference the bra data
+  if( is_diag ) Xb = Xa;
+
+  const int ncA = ncart(la);
+  const int ncB = ncart(lb);
+
+  // Batch over points to bound the size of the integral buffer
+  std::vector<double> V( ncA * ncB * NPTS_LOCAL ), points_loc( 3 * NPTS_LOCAL );
+  for( size_t p0 = 0; p0 < npts; p0 += NPTS_LOCAL ) {
+
+    const size_t np = std::min( size_t(NPTS_LOCAL), npts - p0 );
+    for( int k = 0; k < 3; ++k )
+      std::copy_n( points + k*npts + p0, np, points_loc.data() + k*np );
+
+    compute_potential_shell_pair( np, points_loc.data(), la, lb, ra, rb,
+      nprim_pairs, prim_pairs, V.data(), np, boys_table );
+
+    for( int a = 0; a < ncA; ++a )
+    for( int b = 0; b < ncB; ++b ) {
+      const double* V_ab = V.data() + (a*ncB + b)*np;
+      const double* Xa_i = Xa + a*ldX + p0;
+      const double* Xb_i = Xb + b*ldX + p0;
+      double* Ga_i = Ga + a*ldG + p0;
+      double* Gb_i = Gb + b*ldG + p0;
+      for( size_t i = 0; i < np; ++i ) {
+        const double wv = weights[p0 + i] * V_ab[i];
+        Ga_i[i] += wv * Xb_i[i];
+        if( !is_diag ) Gb_i[i] += wv * Xa_i[i];
+      }
+    }
+
+  } // Loop over point batches
+
+}
+
+}
@@ -10,6 +10,7 @@
 namespace GauXC {
 
 using task_iterator = detail::LocalHostWorkDriverPIMPL::task_iterator;
+using const_task_iterator = detail::LocalHostWorkDriverPIMPL::const_task_iterator;
 
 void reference_ssf_weights_host(
   const Molecule&        mol,
@@ -25,6 +26,40 @@ void reference_becke_weights_host(
   task_iterator          task_end
 );
 
+void reference_ssf_weights_nl_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  task_iterator          task_begin,
+  task_iterator          task_end
+);
+
+void reference_becke_weights_nl_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  task_iterator          task_begin,
+  task_iterator          task_end
+);
+
+/// Accumulate sum_p w_p f_p dW_A(p)/dR_B into GRAD (3 x natoms) for the
+/// Becke / SSF partition weights, f being packed in task order
+void reference_becke_weights_gradient_nl_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  const_task_iterator    task_begin,
+  const_task_iterator    task_end,
+  const double*          f,
+  double*                GRAD
+);
+
+void reference_ssf_weights_gradient_nl_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  const_task_iterator    task_begin,
+  const_task_iterator    task_end,
+  const double*          f,
+  double*                GRAD
+);
+
 void reference_lko_weights_host(
   const Molecule&        mol,
   const MolMeta&         meta,
@@ -0,0 +1,224 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "host/reference/weights.hpp"
+#include "host/reference/weights_neighbor_list.hpp"
+#include "common/integrator_constants.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace GauXC {
+
+namespace {
+
+/**
+ *  Gradient of sum_p w_p f_p W_A(p) for the partition weights W_A built
+ *  from the cell function s(mu) (cell returns {s(mu), s'(mu)}).
+ *
+ *  With P_k = prod_{j!=k} s(mu_kj) and W_A = P_A / Z, Z = sum_k P_k,
+ *
+ *    d ln W_A = sum_k (delta_kA - P_k/Z) sum_{j!=k} s'(mu_kj)/s(mu_kj) dmu_kj
+ *
+ *  where w_p W_A(p) is the stored (partitioned) weight. The quadrature
+ *  points move along with their parent atom: as W_A only depends on the
+ *  relative positions of the point and the atoms, the derivative w.r.t.
+ *  the parent atom follows from translational invariance.
+ *
+ *  Cell functions below tol times the largest preceding one (i.e. other
+ *  than the parent's) are neglected, the
+ *  atoms collected within ratio times the distance of the nearest atom to
+ *  the point are considered.
+ */
+template <typename CellFunction>
+void weights_gradient_nl( const Molecule& mol, const MolMeta& meta,
+  const_task_iterator task_begin, const_task_iterator task_end, double ratio,
+  double tol, const CellFunction& cell, const double* f, double* GRAD ) {
+
+  const size_t ntasks = std::distance(task_begin,task_end);
+  const size_t natoms = mol.natoms();
+
+  // Offsets of the tasks into f
+  std::vector<size_t> task_offset( ntasks + 1, 0 );
+  for( size_t iT = 0; iT < ntasks; ++iT )
+    task_offset[iT+1] = task_offset[iT] + (task_begin+iT)->points.size();
+
+  const PartitionNeighborList neighbors( mol, meta );
+
+  #pragma omp parallel
+  {
+
+  std::vector<int32_t> atomIdx( natoms );
+  std::vector<double>  atomDist( natoms );
+  std::vector<double>  cellP( natoms );
+  std::vector<double>  unitVec( 3*natoms );  // (r - R_k) / r_k
+  std::vector<double>  lnWGrad( 3*natoms );  // d ln W_A / dR_k
+  std::vector<double>  gradLocal( 3*natoms, 0. );
+
+  #pragma omp for schedule(dynamic)
+  for( size_t iT = 0; iT < ntasks; ++iT ) {
+
+    const auto& task   = *(task_begin+iT);
+    const auto* f_task = f + task_offset[iT];
+    const auto  npts   = task.points.size();
+
+    double g_parent[3] = {0., 0., 0.};
+    for( size_t i = 0; i < npts; ++i ) {
+
+      const double wf = task.weights[i] * f_task[i];
+      if( wf == 0. ) continue;
+
+      const auto& point = task.points[i];
+
+      double r_nearest;
+      const auto n = neighbors.collect( mol, point, task.iParent, ratio,
+        atomIdx.data(), atomDist.data(), r_nearest );
+      if( n == 1 ) continue; // W_A = 1
+
+      for( size_t k = 0; k < n; ++k ) {
+        const auto&  atom  = mol[atomIdx[k]];
+        const double r_inv = atomDist[k] > 0. ? 1. / atomDist[k] : 0.;
+        unitVec[3*k + 0] = (point[0] - atom.x) * r_inv;
+        unitVec[3*k + 1] = (point[1] - atom.y) * r_inv;
+        unitVec[3*k + 2] = (point[2] - atom.z) * r_inv;
+      }
+
+      // Unnormalized cell functions, parent first
+      double Z = 0., ps_max = 0.;
+      for( size_t k = 0; k < n; ++k ) {
+        const double ps_tol = tol * ps_max;
+        double ps = 1.;
+        for( size_t j = 0; j < n; ++j )
+        if( j != k ) {
+          const double mu = (atomDist[k] - atomDist[j]) /
+            neighbors.rab( atomIdx[k], atomIdx[j] );
+          ps *= cell(mu).first;
+          if( ps < ps_tol ) { ps = 0.; break; }
+        }
+        cellP[k] = ps;
+        Z += ps;
+        ps_max = std::max( ps_max, ps );
+      }
+      if( cellP[0] == 0. ) continue; // W_A = 0
+
+      std::fill_n( lnWGrad.begin(), 3*n, 0. );
+      for( size_t k = 0; k < n; ++k )
+      if( cellP[k] > 0. ) {
+
+        const double coeff = (k ? 0. : 1.) - cellP[k] / Z;
+        const auto&  atom_k = mol[atomIdx[k]];
+
+        for( size_t j = 0; j < n; ++j )
+        if( j != k ) {
+          const auto&  atom_j = mol[atomIdx[j]];
+          const double R_kj   = neighbors.rab( atomIdx[k], atomIdx[j] );
+          const double mu     = (atomDist[k] - atomDist[j]) / R_kj;
+          const auto   [s, ds] = cell(mu);
+          if( ds == 0. ) continue;
+
+          // dmu_kj/dR_k = -(e_k + mu d_kj) / R_kj
+          // dmu_kj/dR_j =  (e_j + mu d_kj) / R_kj, d_kj = (R_k - R_j) / R_kj
+          const double t    = coeff * ds / (s * R_kj);
+          const double mu_R = mu / R_kj;
+          const double d[3] = { (atom_k.x - atom_j.x) * mu_R,
+                                (atom_k.y - atom_j.y) * mu_R,
+                                (atom_k.z - atom_j.z) * mu_R };
+          for( int x = 0; x < 3; ++x ) {
+            lnWGrad[3*k + x] -= t * (unitVec[3*k + x] + d[x]);
+            lnWGrad[3*j + x] += t * (unitVec[3*j + x] + d[x]);
+          }
+        }
+
+      }
+
+      for( size_t k = 1; k < n; ++k )
+      for( int x = 0; x < 3; ++x ) {
+        const double g = wf * lnWGrad[3*k + x];
+        gradLocal[3*atomIdx[k] + x] += g;
+        g_parent[x] -= g;
+      }
+
+    } // Loop over points
+
+    for( int x = 0; x < 3; ++x ) gradLocal[3*task.iParent + x] += g_parent[x];
+
+  } // Loop over tasks
+
+  for( size_t i = 0; i < 3*natoms; ++i ) {
+    #pragma omp atomic
+    GRAD[i] += gradLocal[i];
+  }
+
+  } // OMP context
+
+}
+
+}
+
+void reference_becke_weights_gradient_nl_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  const_task_iterator    task_begin,
+  const_task_iterator    task_end,
+  const double*          f,
+  double*                GRAD
+) {
+
+  // Becke partition functions
+  auto hBecke  = [](double x) {return 1.5 * x - 0.5 * x * x * x;}; // Eq. 19
+  auto dhBecke = [](double x) {return 1.5 * (1. - x * x);};
+  auto cell = [&]( double mu ) {
+    const double h1 = hBecke(mu);
+    const double h2 = hBecke(h1);
+    const double dg = dhBecke(h2) * dhBecke(h1) * dhBecke(mu);
+    return std::make_pair( 0.5 * (1. - hBecke(h2)), -0.5 * dg );
+  };
+
+  weights_gradient_nl( mol, meta, task_begin, task_end,
+    integrator::becke_neighbor_ratio, integrator::becke_weight_tol, cell,
+    f, GRAD );
+
+}
+
+void reference_ssf_weights_gradient_nl_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  const_task_iterator    task_begin,
+  const_task_iterator    task_end,
+  const double*          f,
+  double*                GRAD
+) {
+
+  constexpr double a = integrator::magic_ssf_factor<>;
+  constexpr double q = (1. + a) / (1. - a);
+
+  auto cell = [&]( double mu ) {
+    if( std::abs(mu) < a ) {
+      const double s_x  = mu / a;
+      const double s_x2 = s_x  * s_x;
+      const double s_x3 = s_x  * s_x2;
+      const double s_x5 = s_x3 * s_x2;
+      const double s_x7 = s_x5 * s_x2;
+      const double g    = (35.*(s_x - s_x3) + 21.*s_x5 - 5.*s_x7) / 16.;
+
+      const double one_m_x2 = 1. - s_x2;
+      const double dg = 35. / (16. * a) * one_m_x2 * one_m_x2 * one_m_x2;
+      return std::make_pair( 0.5 * (1. - g), -0.5 * dg );
+    }
+    else if( mu >= a ) return std::make_pair( 0., 0. );
+    else               return std::make_pair( 1., 0. );
+  };
+
+  // The SSF cell functions (and their derivatives) are exact with the atoms
+  // within q^2 * r_n, see reference_ssf_weights_nl_host
+  weights_gradient_nl( mol, meta, task_begin, task_end, q*q,
+    integrator::ssf_weight_tol, cell, f, GRAD );
+
+}
+
+}
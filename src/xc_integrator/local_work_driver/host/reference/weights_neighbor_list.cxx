@@ -0,0 +1,313 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "host/reference/weights.hpp"
+#include "host/reference/weights_neighbor_list.hpp"
+#include "common/integrator_constants.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace GauXC {
+
+PartitionNeighborList::PartitionNeighborList( const Molecule& mol,
+  const MolMeta& meta ) : natoms_(mol.natoms()), RAB_(meta.rab().data()),
+  cell_atoms_(natoms_) {
+
+  // Bounding box of the atoms
+  std::array<double,3> hi;
+  origin_.fill( std::numeric_limits<double>::infinity() );
+  hi.fill( -std::numeric_limits<double>::infinity() );
+  for( const auto& atom : mol ) {
+    const std::array<double,3> r = { atom.x, atom.y, atom.z };
+    for( int x = 0; x < 3; ++x ) {
+      origin_[x] = std::min( origin_[x], r[x] );
+      hi[x]      = std::max( hi[x],      r[x] );
+    }
+  }
+
+  // Cells holding O(1) atoms on average, the extents are padded such that
+  // flat and linear molecules yield sensible cells
+  double volume = 1.;
+  for( int x = 0; x < 3; ++x ) volume *= hi[x] - origin_[x] + 1.;
+  cell_length_ = std::max( 1., std::cbrt( volume / std::max<size_t>(natoms_,1) ) );
+
+  for( int x = 0; x < 3; ++x )
+    ncells_[x] = int64_t((hi[x] - origin_[x]) / cell_length_) + 1;
+
+  // Bin the atoms (counting sort)
+  auto cell_of = [&]( const Atom& atom ) {
+    const std::array<double,3> r = { atom.x, atom.y, atom.z };
+    std::array<int64_t,3> c;
+    for( int x = 0; x < 3; ++x )
+      c[x] = std::min( ncells_[x] - 1,
+        int64_t((r[x] - origin_[x]) / cell_length_) );
+    return c[0] + ncells_[0] * (c[1] + ncells_[1] * c[2]);
+  };
+
+  cell_offsets_.assign( ncells_[0]*ncells_[1]*ncells_[2] + 1, 0 );
+  for( const auto& atom : mol ) cell_offsets_[cell_of(atom) + 1]++;
+  std::partial_sum( cell_offsets_.begin(), cell_offsets_.end(),
+    cell_offsets_.begin() );
+
+  std::vector<int32_t> fill( cell_offsets_.begin(), cell_offsets_.end() - 1 );
+  for( size_t iA = 0; iA < natoms_; ++iA )
+    cell_atoms_[fill[cell_of(mol[iA])]++] = iA;
+
+}
+
+size_t PartitionNeighborList::collect( const Molecule& mol,
+  const std::array<double,3>& point, int32_t iParent, double ratio,
+  int32_t* idx, double* dist, double& r_nearest ) const {
+
+  auto distance = [&]( int32_t iA ) {
+    const double da_x = point[0] - mol[iA].x;
+    const double da_y = point[1] - mol[iA].y;
+    const double da_z = point[2] - mol[iA].z;
+    return std::sqrt(da_x*da_x + da_y*da_y + da_z*da_z);
+  };
+
+  const double r_parent = distance( iParent );
+  r_nearest = r_parent;
+  idx[0] = iParent; dist[0] = r_parent;
+
+  // Cell of the point (possibly outside of the grid)
+  std::array<int64_t,3> c;
+  for( int x = 0; x < 3; ++x )
+    c[x] = int64_t(std::floor( (point[x] - origin_[x]) / cell_length_ ));
+
+  size_t n = 1;
+  auto collect_cell = [&]( int64_t ix, int64_t iy, int64_t iz ) {
+    const auto ic = ix + ncells_[0] * (iy + ncells_[1] * iz);
+    for( auto i = cell_offsets_[ic]; i < cell_offsets_[ic+1]; ++i ) {
+      const auto iA = cell_atoms_[i];
+      if( iA == iParent ) continue;
+
+      const double r = distance( iA );
+      r_nearest = std::min( r_nearest, r );
+      idx[n] = iA; dist[n] = r; ++n;
+    }
+  };
+
+  // Scan the shells of cells around the point, the cutoff only shrinks
+  // with r_nearest
+  for( int64_t s = 0; ; ++s ) {
+    if( s > 0 and (s-1) * cell_length_ >= ratio * r_nearest ) break;
+
+    std::array<int64_t,3> lo, hi;
+    bool empty = false, last = true;
+    for( int x = 0; x < 3; ++x ) {
+      lo[x] = std::max<int64_t>( c[x] - s, 0 );
+      hi[x] = std::min<int64_t>( c[x] + s, ncells_[x] - 1 );
+      empty = empty or lo[x] > hi[x];
+      last  = last and c[x] - s <= 0 and c[x] + s >= ncells_[x] - 1;
+    }
+
+    // Cells of Chebyshev distance s to the cell of the point
+    if( not empty )
+    for( auto ix = lo[0]; ix <= hi[0]; ++ix )
+    for( auto iy = lo[1]; iy <= hi[1]; ++iy ) {
+      if( std::abs(ix - c[0]) == s or std::abs(iy - c[1]) == s ) {
+        for( auto iz = lo[2]; iz <= hi[2]; ++iz ) collect_cell( ix, iy, iz );
+      } else {
+        if( c[2] - s >= 0 and c[2] - s < ncells_[2] )
+          collect_cell( ix, iy, c[2] - s );
+        if( c[2] + s >= 0 and c[2] + s < ncells_[2] ) 
+          collect_cell( ix, iy, c[2] + s );
+      }
+    }
+
+    if( last ) break; // All cells scanned
+  }
+
+  // Drop the atoms beyond the final cutoff (the parent is kept)
+  size_t n_keep = 1;
+  for( size_t i = 1; i < n; ++i )
+  if( dist[i] < ratio * r_nearest ) {
+    idx[n_keep] = idx[i]; dist[n_keep] = dist[i]; ++n_keep;
+  }
+
+  return n_keep;
+
+}
+
+
+
+void reference_becke_weights_nl_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  task_iterator          task_begin,
+  task_iterator          task_end
+) {
+
+  // Becke partition functions
+  auto hBecke = [](double x) {return 1.5 * x - 0.5 * x * x * x;}; // Eq. 19
+  auto gBecke = [&](double x) {return hBecke(hBecke(hBecke(x)));}; // Eq. 20 f_3
+
+  const size_t ntasks = std::distance(task_begin,task_end);
+  const size_t natoms = mol.natoms();
+
+  const PartitionNeighborList neighbors( mol, meta );
+
+  #pragma omp parallel
+  {
+
+  std::vector<int32_t> atomIdx( natoms );
+  std::vector<double>  atomDist( natoms );
+
+  #pragma omp for schedule(dynamic)
+  for( size_t iT = 0; iT < ntasks;                  ++iT )
+  for( size_t i  = 0; i  < (task_begin+iT)->points.size(); ++i  ) {
+
+    auto&       task   = *(task_begin+iT);
+    auto&       weight = task.weights[i];
+    const auto& point  = task.points[i];
+
+    // The Becke cell functions have no finite support, the atoms beyond the
+    // cutoff only contribute within the screening tolerance
+    double r_nearest;
+    const auto n = neighbors.collect( mol, point, task.iParent,
+      integrator::becke_neighbor_ratio, atomIdx.data(), atomDist.data(),
+      r_nearest );
+
+    // Unnormalized partition functions of the neighbors, parent first.
+    // Cell functions are truncated relative to the largest preceding one
+    // (a bound on the normalization)
+    double sum = 0., parent_weight = 0., ps_max = 0.;
+    for( size_t k = 0; k < n; ++k ) {
+
+      const double ps_tol = integrator::becke_weight_tol * ps_max;
+      double ps = 1.;
+      for( size_t j = 0; j < n; ++j )
+      if( j != k ) {
+        const double mu = (atomDist[k] - atomDist[j]) /
+          neighbors.rab( atomIdx[k], atomIdx[j] );
+        ps *= 0.5 * (1. - gBecke(mu));
+        if( ps < ps_tol ) break;
+      }
+
+      if( k == 0 ) parent_weight = ps;
+      sum += ps;
+      ps_max = std::max( ps_max, ps );
+
+    }
+
+    // Update Weights
+    weight *= parent_weight / sum;
+
+  } // Collapsed loop over tasks and points
+
+  } // OMP context
+
+}
+
+void reference_ssf_weights_nl_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  task_iterator          task_begin,
+  task_iterator          task_end
+) {
+
+  auto gFrisch = [&](double x) {
+    const double s_x  = x / integrator::magic_ssf_factor<>;
+    const double s_x2 = s_x  * s_x;
+    const double s_x3 = s_x  * s_x2;
+    const double s_x5 = s_x3 * s_x2;
+    const double s_x7 = s_x5 * s_x2;
+
+    return (35.*(s_x - s_x3) + 21.*s_x5 - 5.*s_x7) / 16.;
+  };
+
+  auto sFrisch = [&] (double x) {
+    if( std::abs(x) < integrator::magic_ssf_factor<> )
+      return 0.5 * (1. - gFrisch(x));
+    else if( x >= integrator::magic_ssf_factor<> ) return 0.;
+    else                                           return 1.;
+  };
+
+  const size_t ntasks = std::distance(task_begin,task_end);
+  const size_t natoms = mol.natoms();
+
+  // As R_kn <= r_k + r_n, the cell function of an atom k vanishes
+  // (mu_kn >= a) if r_k >= q * r_n with q = (1+a)/(1-a), n being the atom
+  // nearest to the point. Likewise the factor of atom j in the cell
+  // function of atom k is unity if r_j >= q * r_k. The cell functions are
+  // thus exact with the atoms within q^2 * r_n, and only the atoms within
+  // q * r_n contribute to the normalization.
+  constexpr double a = integrator::magic_ssf_factor<>;
+  constexpr double q = (1. + a) / (1. - a);
+
+  const PartitionNeighborList neighbors( mol, meta );
+
+  #pragma omp parallel
+  {
+
+  std::vector<int32_t> atomIdx( natoms );
+  std::vector<double>  atomDist( natoms );
+
+  #pragma omp for schedule(dynamic)
+  for( size_t iT = 0; iT < ntasks;                  ++iT )
+  for( size_t i  = 0; i  < (task_begin+iT)->points.size(); ++i  ) {
+
+    auto&       task   = *(task_begin+iT);
+    auto&       weight = task.weights[i];
+    const auto& point  = task.points[i];
+
+    const auto dist_cutoff = 0.5 * (1-a) * task.dist_nearest;
+
+    // Compute dist to parent atom
+    {
+      const double da_x = point[0] - mol[task.iParent].x;
+      const double da_y = point[1] - mol[task.iParent].y;
+      const double da_z = point[2] - mol[task.iParent].z;
+
+      const double r_parent = std::sqrt(da_x*da_x + da_y*da_y + da_z*da_z);
+      if( r_parent < dist_cutoff ) continue; // Partition weight = 1
+    }
+
+    double r_nearest;
+    const auto n = neighbors.collect( mol, point, task.iParent, q*q,
+      atomIdx.data(), atomDist.data(), r_nearest );
+
+    // Partition weight = 0
+    if( atomDist[0] >= q * r_nearest ) {
+      weight = 0.;
+      continue;
+    }
+
+    // Unnormalized partition functions of the contributing atoms, parent
+    // first
+    double sum = 0., parent_weight = 0.;
+    for( size_t k = 0; k < n; ++k )
+    if( atomDist[k] < q * r_nearest ) {
+
+      double ps = 1.;
+      for( size_t j = 0; j < n; ++j )
+      if( j != k ) {
+        const double mu = (atomDist[k] - atomDist[j]) /
+          neighbors.rab( atomIdx[k], atomIdx[j] );
+        ps *= sFrisch( mu );
+        if( ps <= integrator::ssf_weight_tol ) break;
+      }
+
+      if( k == 0 ) parent_weight = ps;
+      sum += ps;
+
+    }
+
+    // Update Weights
+    weight *= parent_weight / sum;
+
+  } // Collapsed loop over tasks and points
+
+  } // OMP context
+
+}
+
+}
@@ -0,0 +1,70 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/molecule.hpp>
+#include <gauxc/molmeta.hpp>
+#include <array>
+#include <vector>
+
+namespace GauXC {
+
+/**
+ *  @brief Neighbor lists for the screened evaluation of partition weights
+ *
+ *  Bins the atoms of the molecule into a uniform grid of cubic cells
+ *  (O(natoms) storage and construction). The atoms within a cutoff of a
+ *  point are collected by scanning the cells in shells of increasing
+ *  Chebyshev distance s around the cell of the point: as the atoms of
+ *  shell s are further than (s-1) * cell_length from the point, the scan
+ *  stops once (s-1) * cell_length exceeds the cutoff.
+ */
+class PartitionNeighborList {
+
+  size_t                 natoms_;
+  const double*          RAB_;
+  std::array<double,3>   origin_;      ///< Lower corner of the cell grid
+  double                 cell_length_;
+  std::array<int64_t,3>  ncells_;
+  std::vector<int32_t>   cell_offsets_; ///< CSR offsets into cell_atoms_
+  std::vector<int32_t>   cell_atoms_;   ///< Atoms binned on their cell
+
+public:
+
+  PartitionNeighborList( const Molecule& mol, const MolMeta& meta );
+
+  inline size_t natoms() const { return natoms_; }
+
+  /// Interatomic distance R_ij
+  inline double rab( int32_t i, int32_t j ) const {
+    return RAB_[i + j*natoms_];
+  }
+
+  /**
+   *  @brief Collect the atoms within ratio * r_nearest of a point
+   *
+   *  @param[in]  mol        Molecule of the neighbor list
+   *  @param[in]  point      Quadrature point
+   *  @param[in]  iParent    Parent atom of point
+   *  @param[in]  ratio      Cutoff relative to the distance of the nearest
+   *                         atom to point (>= 1)
+   *  @param[out] idx        Indices of the collected atoms, iParent first
+   *                         (natoms scratch)
+   *  @param[out] dist       Distances of the collected atoms to point
+   *                         (natoms scratch)
+   *  @param[out] r_nearest  Distance of the nearest atom to point
+   *
+   *  @returns The number of collected atoms
+   */
+  size_t collect( const Molecule& mol, const std::array<double,3>& point,
+    int32_t iParent, double ratio, int32_t* idx, double* dist,
+    double& r_nearest ) const;
+
+};
+
+}
@@ -12,6 +12,7 @@
 
 #include "host/util.hpp"
 #include "host/blas.hpp"
+#include "host/shell_pair_engine.hpp"
 #include <stdexcept>
 
 #include <gauxc/basisset_map.hpp>
@@ -36,13 +37,19 @@ namespace GauXC {
   // Partition weights
   void ReferenceLocalHostWorkDriver::partition_weights( XCWeightAlg weight_alg, 
 							const Molecule& mol, const MolMeta& meta, task_iterator task_begin, 
-							task_iterator task_end ) {
+							task_iterator task_end, bool neighbor_list ) {
     switch( weight_alg ) {
       case XCWeightAlg::Becke:
-        reference_becke_weights_host( mol, meta, task_begin, task_end );
+        if( neighbor_list )
+          reference_becke_weights_nl_host( mol, meta, task_begin, task_end );
+        else
+          reference_becke_weights_host( mol, meta, task_begin, task_end );
         break;
       case XCWeightAlg::SSF:
-        reference_ssf_weights_host( mol, meta, task_begin, task_end );
+        if( neighbor_list )
+          reference_ssf_weights_nl_host( mol, meta, task_begin, task_end );
+        else
+          reference_ssf_weights_host( mol, meta, task_begin, task_end );
         break;
       case XCWeightAlg::LKO:
         reference_lko_weights_host( mol, meta, task_begin, task_end );
@@ -52,6 +59,24 @@ namespace GauXC {
     }
   }
 
+  void ReferenceLocalHostWorkDriver::partition_weights_gradient( 
+    XCWeightAlg weight_alg, const Molecule& mol, const MolMeta& meta, 
+    const_task_iterator task_begin, const_task_iterator task_end, 
+    const double* f, double* GRAD ) {
+    switch( weight_alg ) {
+      case XCWeightAlg::Becke:
+        reference_becke_weights_gradient_nl_host( mol, meta, task_begin, 
+          task_end, f, GRAD );
+        break;
+      case XCWeightAlg::SSF:
+        reference_ssf_weights_gradient_nl_host( mol, meta, task_begin, 
+          task_end, f, GRAD );
+        break;
+      default:
+        GAUXC_GENERIC_EXCEPTION("Weight Gradient Not Supported for Weight Alg");
+    }
+  }
+
 
   // Collocation
   void ReferenceLocalHostWorkDriver::eval_collocation( size_t npts, size_t nshells, 
@@ -1048,7 +1073,8 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
       blas::gemm( 'N', 'T', nbe_bra, nbe_ket, npts, 1., basis_eval, nbe_bra,
 		  G, ldg, 0., scr, nbe_bra );
 
-      detail::inc_by_submat_atomic( nbf, nbf, nbe_bra, nbe_ket, K, ldk, scr, nbe_bra, 
+      // K is thread private, no synchronization required
+      detail::inc_by_submat( nbf, nbf, nbe_bra, nbe_ket, K, ldk, scr, nbe_bra, 
 			     submat_map_bra, submat_map_ket );
 
   }
@@ -1078,13 +1104,152 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
 
   }
 
+  // Bounding sphere (centroid + max distance) of a set of points
+  static void points_bounding_sphere( size_t npts, const XCPU::point* points,
+    XCPU::point& center, double& radius ) {
+
+    center = XCPU::point{0., 0., 0.};
+    radius = 0.;
+    for( size_t i = 0; i < npts; ++i ) {
+      center.x += points[i].x;
+      center.y += points[i].y;
+      center.z += points[i].z;
+    }
+    center.x /= npts; center.y /= npts; center.z /= npts;
+    for( size_t i = 0; i < npts; ++i ) {
+      const auto dx = points[i].x - center.x;
+      const auto dy = points[i].y - center.y;
+      const auto dz = points[i].z - center.z;
+      radius = std::max( radius, std::sqrt(dx*dx + dy*dy + dz*dz) );
+    }
+
+  }
+
+  // Scaled interaction tensors T(m,i) = fac(i) * T_m(r_i - O) of the
+  // multipole expansion about the shell pair center O
+  //   A(a,b,i) ~ q(a,b) / R + d(a,b).R / R^3 + 
+  //              Q(a,b):(3 R R - R^2 I) / (2 R^5),  R = r_i - O
+  static void eval_multipole_tensors( size_t npts, const XCPU::point* points,
+    const double* fac, const ShellPairMultipoles<double>& mp, 
+    std::vector<double>& T ) {
+
+    constexpr int nmom = ShellPairMultipoles<double>::nmoments;
+    T.resize( nmom * npts );
+
+    for( size_t i = 0; i < npts; ++i ) {
+      const auto Rx = points[i].x - mp.center.x;
+      const auto Ry = points[i].y - mp.center.y;
+      const auto Rz = points[i].z - mp.center.z;
+      const auto R2 = Rx*Rx + Ry*Ry + Rz*Rz;
+      const auto R1_inv = 1. / std::sqrt(R2);
+      const auto R3_inv = fac[i] * R1_inv * R1_inv * R1_inv;
+      const auto R5_inv = R3_inv * R1_inv * R1_inv;
+
+      T[i + 0*npts] = fac[i] * R1_inv;
+      T[i + 1*npts] = Rx * R3_inv;
+      T[i + 2*npts] = Ry * R3_inv;
+      T[i + 3*npts] = Rz * R3_inv;
+      T[i + 4*npts] = 0.5 * (3.*Rx*Rx - R2) * R5_inv;
+      T[i + 5*npts] = 3. * Rx * Ry * R5_inv;
+      T[i + 6*npts] = 3. * Rx * Rz * R5_inv;
+      T[i + 7*npts] = 0.5 * (3.*Ry*Ry - R2) * R5_inv;
+      T[i + 8*npts] = 3. * Ry * Rz * R5_inv;
+      T[i + 9*npts] = 0.5 * (3.*Rz*Rz - R2) * R5_inv;
+    }
+
+  }
+
   // Construct G(mu,i) = w(i) * A(mu,nu,i) * F(nu, i)
+  // Far-field contribution of a shell pair to G through its multipole
+  // expansion about the shell pair center
+  static void eval_exx_gmat_multipole( bool is_diag, size_t npts, 
+    const XCPU::point* points, const double* weights, 
+    const ShellPairMultipoles<double>& mp, int ncart_a, int ncart_b, 
+    const double* Xa, const double* Xb, size_t ldx, double* Ga, double* Gb, 
+    size_t ldg, std::vector<double>& T ) {
+
+    constexpr int nmom = ShellPairMultipoles<double>::nmoments;
+
+    // Weighted interaction tensors T(m,i)
+    eval_multipole_tensors( npts, points, weights, mp, T );
+
+    for( int ia = 0; ia < ncart_a; ++ia )
+    for( int ib = 0; ib < ncart_b; ++ib ) {
+      const auto* m_ab = mp.moments.data() + (ib + ia*ncart_b) * nmom;
+      const auto* Xa_i = Xa + ia*ldx;
+      const auto* Xb_i = Xb + ib*ldx;
+      auto* Ga_i = Ga + ia*ldg;
+      auto* Gb_i = Gb + ib*ldg;
+
+      #pragma omp simd
+      for( size_t i = 0; i < npts; ++i ) {
+        double v = 0.;
+        for( int m = 0; m < nmom; ++m ) v += m_ab[m] * T[i + m*npts];
+        Ga_i[i] += v * Xb_i[i];
+        if( !is_diag ) Gb_i[i] += v * Xa_i[i];
+      }
+    }
+
+  }
+
+  // G(a,i) += w(i) * sum_b A(a,b,i) * X(b,i) (and vice versa) for a general
+  // operator through the explicit potential integrals A(a,b,i)
+  static void eval_exx_gmat_potential( bool is_diag, size_t npts, 
+    const double* points_transposed, const double* weights, 
+    const Shell<double>& bra, const Shell<double>& ket, 
+    const ShellPair<double>& sh_pair, const double* X_bra, const double* X_ket,
+    size_t ldx, double* G_bra, double* G_ket, size_t ldg, double alpha, 
+    double beta, double omega, double* boys_table, std::vector<double>& V ) {
+
+    // Integrals are generated with the higher-l shell first
+    const bool swap = bra.l() < ket.l();
+    const auto& sh_a = swap ? ket : bra;
+    const auto& sh_b = swap ? bra : ket;
+    const auto* Xa = swap ? X_ket : X_bra;
+    const auto* Xb = swap ? X_bra : X_ket;
+    auto* Ga = swap ? G_ket : G_bra;
+    auto* Gb = swap ? G_bra : G_ket;
+
+    const int ncart_a = sh_a.cart_size();
+    const int ncart_b = sh_b.cart_size();
+    V.resize( ncart_a * ncart_b * npts );
+
+    XCPU::point a_origin{sh_a.O()[0],sh_a.O()[1],sh_a.O()[2]};
+    XCPU::point b_origin{sh_b.O()[0],sh_b.O()[1],sh_b.O()[2]};
+    XCPU::compute_potential_shell_pair( npts, points_transposed, sh_a.l(), 
+      sh_b.l(), a_origin, b_origin, sh_pair.nprim_pairs(), 
+      sh_pair.prim_pairs(), V.data(), npts, boys_table, alpha, beta, omega );
+
+    for( int a = 0; a < ncart_a; ++a )
+    for( int b = 0; b < ncart_b; ++b ) {
+      const auto* V_ab = V.data() + (a*ncart_b + b)*npts;
+      auto* Ga_i = Ga + a*ldg;
+      auto* Gb_i = Gb + b*ldg;
+      const auto* Xa_i = Xa + a*ldx;
+      const auto* Xb_i = Xb + b*ldx;
+      for( size_t i = 0; i < npts; ++i ) {
+        const auto wv = weights[i] * V_ab[i];
+        Ga_i[i] += wv * Xb_i[i];
+        if( !is_diag ) Gb_i[i] += wv * Xa_i[i];
+      }
+    }
+
+  }
+
+  void ReferenceLocalHostWorkDriver::setup_shell_pair_engines( 
+    const RuntimeEnvironment& rt ) {
+
+    detail::ShellPairEngineTable::initialize( this->boys_table, rt );
+
+  }
+
   void ReferenceLocalHostWorkDriver::eval_exx_gmat( size_t npts, size_t nshells, 
     size_t nshell_pairs, size_t nbe, const double* points, const double* weights, 
     const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
     const BasisSetMap& basis_map, const int32_t* shell_list, 
     const std::pair<int32_t,int32_t>* shell_pair_list, 
-    const double* X, size_t ldx, double* G, size_t ldg ) {
+    const double* X, size_t ldx, double* G, size_t ldg, double mp_tol,
+    ShellPairIntegralEngine engine, double alpha, double beta, double omega ) {
 
     util::unused(basis_map);
 
@@ -1108,7 +1273,7 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
 
 
     // Spherical Harmonic Transformer
-    util::SphericalHarmonicTransform sph_trans(5);
+    util::SphericalHarmonicTransform sph_trans(GAUXC_CPU_SNLINK_MAX_AM);
 
     const bool any_pure = std::any_of( shell_list, shell_list + nshells,
 				       [&](const auto& i){ return basis.at(i).pure(); } );
@@ -1166,6 +1331,28 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
       cou_offsets_map[shell_list[i]] = cou_cart_sizes[i];
     }
 
+    // Range-separated operators (alpha + beta * erf(omega*r)) / r are
+    // evaluated through the explicit potential integrals
+    const bool attenuated = omega > 0. and beta != 0.;
+
+    // Bounding sphere of the points for the far-field multipole criterion
+    // (the multipole expansion is only valid for the bare Coulomb operator)
+    const bool use_multipoles = mp_tol > 0. and shpairs.has_multipoles() and
+      not attenuated;
+    XCPU::point task_center{0., 0., 0.};
+    double task_radius = 0.;
+    if( use_multipoles ) 
+      points_bounding_sphere( npts, _points, task_center, task_radius );
+    std::vector<double> mp_tensor;
+
+    // Per-class engine selection (see setup_shell_pair_engines)
+    const detail::ShellPairEngineTable* engine_table = nullptr;
+    if( engine == ShellPairIntegralEngine::Auto and not attenuated ) {
+      engine_table = detail::ShellPairEngineTable::instance();
+      if( not engine_table ) engine = ShellPairIntegralEngine::ObaraSaika;
+    }
+    thread_local std::vector<double> rys_scr;
+
     size_t ndo = 0;
     {
 #if 0
@@ -1221,11 +1408,52 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
       const auto joff_cart = cou_offsets_map.at(jsh) * npts;
       XCPU::point ket_origin{ket.O()[0],ket.O()[1],ket.O()[2]};
 
-      auto sh_pair = shpairs.at(ish,jsh);
-      auto prim_pair_data = sh_pair.prim_pairs();
+      const auto& sh_pair = shpairs.at(ish,jsh);
+      auto prim_pair_data = const_cast<XCPU::prim_pair*>(sh_pair.prim_pairs());
       auto nprim_pair     = sh_pair.nprim_pairs();
+
+      // Far-field shell pairs are treated by their multipole expansion
+      if( use_multipoles and !sh_pair.multipoles().empty() ) {
+        const auto& mp = sh_pair.multipoles();
+        const auto dx = mp.center.x - task_center.x;
+        const auto dy = mp.center.y - task_center.y;
+        const auto dz = mp.center.z - task_center.z;
+        const auto dist = std::sqrt(dx*dx + dy*dy + dz*dz) - task_radius;
+        if( dist > mp.far_field_radius(mp_tol) ) {
+          // Multipole data is stored with the higher-l shell first
+          const bool swap = bra.l() < ket.l();
+          const auto& sh_a = swap ? ket : bra;
+          const auto& sh_b = swap ? bra : ket;
+          const auto a_off = swap ? joff_cart : ioff_cart;
+          const auto b_off = swap ? ioff_cart : joff_cart;
+          eval_exx_gmat_multipole( ish == jsh, npts, _points, weights, mp,
+            sh_a.cart_size(), sh_b.cart_size(), X_cart_rm.data() + a_off,
+            X_cart_rm.data() + b_off, npts, G_cart_rm.data() + a_off, 
+            G_cart_rm.data() + b_off, npts, mp_tensor );
+          continue;
+        }
+      }
       
       ndo++;  
+      if( attenuated ) {
+        eval_exx_gmat_potential( ish == jsh, npts, _points_transposed.data(),
+          weights, bra, ket, sh_pair, X_cart_rm.data()+ioff_cart, 
+          X_cart_rm.data()+joff_cart, npts, G_cart_rm.data()+ioff_cart, 
+          G_cart_rm.data()+joff_cart, npts, alpha, beta, omega, 
+          this->boys_table, rys_scr );
+        continue;
+      }
+
+      const auto pair_engine = engine_table ? 
+        engine_table->select( bra.l(), ket.l(), nprim_pair ) : engine;
+      if( pair_engine == ShellPairIntegralEngine::Rys ) {
+        detail::rys_gmat_shell_pair( ish == jsh, npts, points, bra, ket,
+          X_cart_rm.data()+ioff_cart, X_cart_rm.data()+joff_cart, npts,
+          G_cart_rm.data()+ioff_cart, G_cart_rm.data()+joff_cart, npts,
+          weights, rys_scr );
+        continue;
+      }
+
       XCPU::compute_integral_shell_pair( ish == jsh,
       				   npts, _points_transposed.data(),
       				   bra.l(), ket.l(), bra_origin, ket_origin,
@@ -1238,9 +1466,11 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
     }
     //std::cout << "NDO " << ndo << " " << ndo / double(nshells*(nshells+1)/2) << std::endl;
    
+    // The bare Coulomb kernels are scaled by alpha after the fact
+    const double g_scale = attenuated ? 1. : alpha;
     for( auto i = 0ul; i < nbe_cart; ++i )
     for( auto j = 0ul; j < npts;     ++j ) {
-	    G_use[i + j*ldg_use] = G_cart_rm[i*npts + j];
+	    G_use[i + j*ldg_use] = g_scale * G_cart_rm[i*npts + j];
     }
   
     // Transform G back to spherical
@@ -1268,4 +1498,130 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
 
   } // GMAT
 
+
+
+  void ReferenceLocalHostWorkDriver::inc_coulomb_j( size_t npts, 
+    size_t nshell_pairs, const double* points, const double* weights, 
+    const double* den, const BasisSet<double>& basis, 
+    const ShellPairCollection<double>& shpairs, const BasisSetMap& basis_map, 
+    const std::pair<int32_t,int32_t>* shell_pair_list, double* J, size_t ldj, 
+    double mp_tol ) {
+
+    // Cast points to Rys format (binary compatable)
+    const XCPU::point* _points = 
+      reinterpret_cast<const XCPU::point*>(points);
+    std::vector<double> _points_transposed(3 * npts);
+
+    for(size_t i = 0; i < npts; ++i) {
+      _points_transposed[i + 0 * npts] = _points[i].x;
+      _points_transposed[i + 1 * npts] = _points[i].y;
+      _points_transposed[i + 2 * npts] = _points[i].z;
+    }
+
+    // Quadrature weighted density
+    std::vector<double> wden( npts );
+    for( size_t i = 0; i < npts; ++i ) wden[i] = weights[i] * den[i];
+
+    // Bounding sphere of the points for the far-field multipole criterion
+    const bool use_multipoles = mp_tol > 0. and shpairs.has_multipoles();
+    XCPU::point task_center{0., 0., 0.};
+    double task_radius = 0.;
+    if( use_multipoles ) 
+      points_bounding_sphere( npts, _points, task_center, task_radius );
+
+    // Spherical Harmonic Transformer
+    util::SphericalHarmonicTransform sph_trans(GAUXC_CPU_SNLINK_MAX_AM);
+
+    std::vector<double> V, J_cart, J_half, J_sph, mp_tensor;
+    for( auto ij = 0ul; ij < nshell_pairs; ++ij ) {
+      auto [ish,jsh] = shell_pair_list[ij];
+
+      const auto& sh_pair = shpairs.at(ish,jsh);
+      const auto nprim_pair = sh_pair.nprim_pairs();
+      if( !nprim_pair ) continue;
+
+      // Integrals are generated with the higher-l shell first
+      const bool swap = basis.at(ish).l() < basis.at(jsh).l();
+      const auto ash  = swap ? jsh : ish;
+      const auto bsh  = swap ? ish : jsh;
+      const auto& sh_a = basis.at(ash);
+      const auto& sh_b = basis.at(bsh);
+      const int ncart_a = sh_a.cart_size();
+      const int ncart_b = sh_b.cart_size();
+      const int nab     = ncart_a * ncart_b;
+
+      J_cart.resize( nab );
+
+      bool far_field = false;
+      if( use_multipoles and !sh_pair.multipoles().empty() ) {
+        const auto& mp = sh_pair.multipoles();
+        const auto dx = mp.center.x - task_center.x;
+        const auto dy = mp.center.y - task_center.y;
+        const auto dz = mp.center.z - task_center.z;
+        const auto dist = std::sqrt(dx*dx + dy*dy + dz*dz) - task_radius;
+        far_field = dist > mp.far_field_radius(mp_tol);
+      }
+
+      if( far_field ) {
+        // J(a,b) = sum_m M(a,b,m) * sum_i w(i) * rho(i) * T(m,i)
+        constexpr int nmom = ShellPairMultipoles<double>::nmoments;
+        const auto& mp = sh_pair.multipoles();
+        eval_multipole_tensors( npts, _points, wden.data(), mp, mp_tensor );
+
+        double T_sum[nmom];
+        for( int m = 0; m < nmom; ++m ) {
+          T_sum[m] = 0.;
+          for( size_t i = 0; i < npts; ++i ) T_sum[m] += mp_tensor[i + m*npts];
+        }
+
+        for( int ab = 0; ab < nab; ++ab ) {
+          const auto* m_ab = mp.moments.data() + ab * nmom;
+          double tmp = 0.;
+          for( int m = 0; m < nmom; ++m ) tmp += m_ab[m] * T_sum[m];
+          J_cart[ab] = tmp;
+        }
+      } else {
+        // J(a,b) = sum_i A(a,b,i) * w(i) * rho(i)
+        V.resize( nab * npts );
+        XCPU::point a_origin{sh_a.O()[0],sh_a.O()[1],sh_a.O()[2]};
+        XCPU::point b_origin{sh_b.O()[0],sh_b.O()[1],sh_b.O()[2]};
+        XCPU::compute_potential_shell_pair( npts, _points_transposed.data(),
+          sh_a.l(), sh_b.l(), a_origin, b_origin, nprim_pair, 
+          sh_pair.prim_pairs(), V.data(), npts, this->boys_table );
+
+        blas::gemm( 'T', 'N', nab, 1, npts, 1., V.data(), npts, wden.data(),
+          npts, 0., J_cart.data(), nab );
+      }
+
+      // Transform J(a,b) (row major) into the spherical basis
+      const int nbf_a = sh_a.size();
+      const int nbf_b = sh_b.size();
+      const double* J_use = J_cart.data();
+      if( sh_a.pure() and sh_a.l() > 0 ) {
+        J_half.resize( nbf_a * ncart_b );
+        sph_trans.tform_bra_rm( sh_a.l(), ncart_b, J_use, ncart_b, 
+          J_half.data(), ncart_b );
+        J_use = J_half.data();
+      }
+      if( sh_b.pure() and sh_b.l() > 0 ) {
+        J_sph.resize( nbf_a * nbf_b );
+        sph_trans.tform_bra_cm( sh_b.l(), nbf_a, J_use, ncart_b, 
+          J_sph.data(), nbf_b );
+        J_use = J_sph.data();
+      }
+
+      // Increment J(mu,nu) and J(nu,mu)
+      const auto a_st = basis_map.shell_to_first_ao(ash);
+      const auto b_st = basis_map.shell_to_first_ao(bsh);
+      for( int a = 0; a < nbf_a; ++a )
+      for( int b = 0; b < nbf_b; ++b ) {
+        const auto J_ab = J_use[a*nbf_b + b];
+        J[(a_st + a) + (b_st + b)*ldj] += J_ab;
+        if( ash != bsh ) J[(b_st + b) + (a_st + a)*ldj] += J_ab;
+      }
+
+    } // Loop over shell pairs
+
+  } // inc_coulomb_j
+
 }
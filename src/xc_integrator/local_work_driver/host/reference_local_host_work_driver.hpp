@@ -28,7 +28,11 @@ struct ReferenceLocalHostWorkDriver : public detail::LocalHostWorkDriverPIMPL {
   // Public APIs
 
   void partition_weights( XCWeightAlg weight_alg, const Molecule& mol, 
-    const MolMeta& meta, task_iterator task_begin, task_iterator task_end ) override;
+    const MolMeta& meta, task_iterator task_begin, task_iterator task_end,
+    bool neighbor_list ) override;
+  void partition_weights_gradient( XCWeightAlg weight_alg, const Molecule& mol,
+    const MolMeta& meta, const_task_iterator task_begin, 
+    const_task_iterator task_end, const double* f, double* GRAD ) override;
 
   void eval_collocation( size_t npts, size_t nshells, size_t nbe, 
     const double* pts, const BasisSet<double>& basis, const int32_t* shell_list, 
@@ -59,12 +63,15 @@ struct ReferenceLocalHostWorkDriver : public detail::LocalHostWorkDriverPIMPL {
     const double* basis_eval, size_t ldb, double* X, size_t ldx, double* scr ) 
     override;
 
+  void setup_shell_pair_engines( const RuntimeEnvironment& rt ) override;
+
   void eval_exx_gmat( size_t npts, size_t nshells, size_t nshell_pairs,
     size_t nbe, const double* points, const double* weights, 
     const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
     const BasisSetMap& basis_map, const int32_t* shell_list, 
     const std::pair<int32_t,int32_t>* shell_pair_list, 
-    const double* X, size_t ldx, double* G, size_t ldg ) override ;
+    const double* X, size_t ldx, double* G, size_t ldg, double mp_tol,
+    ShellPairIntegralEngine engine, double alpha, double beta, double omega ) override ;
 
   void eval_exx_fmat( size_t npts, size_t nbf, size_t nbe_bra,
     size_t nbe_ket, const submat_map_t& submat_map_bra,
@@ -76,6 +83,13 @@ struct ReferenceLocalHostWorkDriver : public detail::LocalHostWorkDriverPIMPL {
     const double* basis_eval, const submat_map_t& submat_map_bra, 
     const submat_map_t& submat_map_ket, const double* G, size_t ldg, double* K, 
     size_t ldk, double* scr ) override;
+
+  void inc_coulomb_j( size_t npts, size_t nshell_pairs,
+    const double* points, const double* weights, const double* den,
+    const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
+    const BasisSetMap& basis_map, 
+    const std::pair<int32_t,int32_t>* shell_pair_list, 
+    double* J, size_t ldj, double mp_tol ) override;
     
   void eval_uvvar_lda_rks( size_t npts, size_t nbe, const double* basis_eval,
     const double* X, size_t ldx, double* den_eval) override;
@@ -1,6 +1,8 @@
 #ifndef __RYS_INTEGRALS
 #define __RYS_INTEGRALS
 
+#include <stddef.h>
+
 typedef struct {
   double x, y, z;
 } point;
@@ -39,6 +41,12 @@ extern "C" {
 void compute_integral(int n, shells *shell_list, int m, point *points, double *output);
 void compute_integral_shell_pair( int npts, shells sh0, shells sh1, 
                                   point *points, double* matrix ); 
+/* Same as compute_integral_shell_pair with caller provided work space of
+   compute_integral_shell_pair_scratch_size() doubles */
+size_t compute_integral_shell_pair_scratch_size( void );
+void compute_integral_shell_pair_scr( int npts, shells sh0, shells sh1, 
+                                      point *points, double* matrix,
+                                      double* scr ); 
 void compute_integral_shell_pair_pre( int npts, shell_pair shpair,
                                       point* points, double* matrix );
 #ifdef __cplusplus
@@ -487,16 +487,32 @@ void compute_integral(int n, shells *shell_list, int m, point *points, double *m
   free(hrr_array);
 }
 
+size_t compute_integral_shell_pair_scratch_size( void ) {
+  return 2 * PB * R_MAX + 3 * (Lx + Ly + 1) * R_MAX + 
+    3 * (Lx + 1) * (Ly + 1) * R_MAX;
+}
+
 void compute_integral_shell_pair( int npts,
 				  shells sh0,
 				  shells sh1, 
                                   point *points,
 				  double *matrix ) {
-  double *rts = (double*) malloc(PB * R_MAX * sizeof(double));
-  double *wgh = (double*) malloc(PB * R_MAX * sizeof(double));
+  double *scr = (double*) malloc(compute_integral_shell_pair_scratch_size() * sizeof(double));
+  compute_integral_shell_pair_scr(npts, sh0, sh1, points, matrix, scr);
+  free(scr);
+}
 
-  double *vrr_array = (double*) malloc(3 * (Lx + Ly + 1) * R_MAX * sizeof(double));
-  double *hrr_array = (double*) malloc(3 * (Lx + 1) * (Ly + 1) * R_MAX * sizeof(double));
+void compute_integral_shell_pair_scr( int npts,
+				      shells sh0,
+				      shells sh1, 
+				      point *points,
+				      double *matrix,
+				      double *scr ) {
+  double *rts = scr;
+  double *wgh = rts + PB * R_MAX;
+
+  double *vrr_array = wgh + PB * R_MAX;
+  double *hrr_array = vrr_array + 3 * (Lx + Ly + 1) * R_MAX;
 
   // values
   double xA = sh0.origin.x;
@@ -624,12 +640,6 @@ void compute_integral_shell_pair( int npts,
       }
     }
   }
-  
-  free(rts);
-  free(wgh);
-
-  free(vrr_array);
-  free(hrr_array);
 }
 
 #if 0
@@ -0,0 +1,213 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "host/shell_pair_engine.hpp"
+#include <gauxc/shell_pair.hpp>
+#include "cpu/integral_data_types.hpp"
+#include "cpu/obara_saika_integrals.hpp"
+#include "rys_integral.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <random>
+
+namespace GauXC {
+namespace detail {
+
+void rys_gmat_shell_pair( bool is_diag, size_t npts, const double* points,
+  const Shell<double>& sh_a, const Shell<double>& sh_b, const double* Xa,
+  const double* Xb, size_t ldx, double* Ga, double* Gb, size_t ldg,
+  const double* weights, std::vector<double>& scr ) {
+
+  const int ncA = sh_a.cart_size();
+  const int ncB = sh_b.cart_size();
+  const int npA = sh_a.nprim();
+  const int npB = sh_b.nprim();
+
+  std::array<coefficients,shell_nprim_max> coeff_a, coeff_b;
+  for( int i = 0; i < npA; ++i ) coeff_a[i] = { sh_a.alpha()[i], sh_a.coeff()[i] };
+  for( int i = 0; i < npB; ++i ) coeff_b[i] = { sh_b.alpha()[i], sh_b.coeff()[i] };
+
+  shells rys_a{ {sh_a.O()[0], sh_a.O()[1], sh_a.O()[2]}, coeff_a.data(), npA, sh_a.l() };
+  shells rys_b{ {sh_b.O()[0], sh_b.O()[1], sh_b.O()[2]}, coeff_b.data(), npB, sh_b.l() };
+
+  // A(a,b,i) stored as scr[i*ncA*ncB + a*ncB + b]
+  const size_t shpair_sz = ncA * ncB;
+  scr.resize( shpair_sz * npts );
+
+  // Points are binary compatible with the Rys format
+  thread_local std::vector<double> rys_work( 
+    compute_integral_shell_pair_scratch_size() );
+  auto* rys_points = reinterpret_cast<point*>(const_cast<double*>(points));
+  compute_integral_shell_pair_scr( npts, rys_a, rys_b, rys_points, scr.data(),
+    rys_work.data() );
+
+  // Diagonal pairs only reference the bra data
+  if( is_diag ) Xb = Xa;
+
+  for( size_t i = 0; i < npts; ++i ) {
+    const double* A_i = scr.data() + i*shpair_sz;
+    const double  w   = weights[i];
+    for( int a = 0; a < ncA; ++a ) {
+      double g = 0.;
+      for( int b = 0; b < ncB; ++b ) g += A_i[a*ncB + b] * Xb[b*ldx + i];
+      Ga[a*ldg + i] += w * g;
+    }
+    if( !is_diag ) {
+      for( int b = 0; b < ncB; ++b ) {
+        double g = 0.;
+        for( int a = 0; a < ncA; ++a ) g += A_i[a*ncB + b] * Xa[a*ldx + i];
+        Gb[b*ldg + i] += w * g;
+      }
+    }
+  }
+
+}
+
+int ShellPairEngineTable::nprim_class( size_t nprim_pair ) {
+  for( int i = 0; i < nprim_classes; ++i )
+    if( nprim_pair <= size_t(nprim_class_bounds[i]) ) return i;
+  return nprim_classes - 1;
+}
+
+ShellPairIntegralEngine ShellPairEngineTable::select( int la, int lb,
+  size_t nprim_pair ) const {
+  if( la < lb ) std::swap(la, lb);
+  if( la > max_l ) return ShellPairIntegralEngine::ObaraSaika;
+  return table_[ (la*(max_l+1) + lb)*nprim_classes + nprim_class(nprim_pair) ];
+}
+
+namespace {
+std::unique_ptr<const ShellPairEngineTable> engine_table;
+std::atomic<const ShellPairEngineTable*>    engine_table_ptr = nullptr;
+std::once_flag                              engine_table_flag;
+}
+
+const ShellPairEngineTable& ShellPairEngineTable::initialize( 
+  double* boys_table, const RuntimeEnvironment& rt ) {
+  std::call_once( engine_table_flag, [&]() {
+    engine_table.reset( new ShellPairEngineTable( boys_table, rt ) );
+    engine_table_ptr = engine_table.get();
+  });
+  return *engine_table;
+}
+
+const ShellPairEngineTable* ShellPairEngineTable::instance() {
+  return engine_table_ptr;
+}
+
+ShellPairEngineTable::ShellPairEngineTable( double* boys_table, 
+  const RuntimeEnvironment& rt ) {
+
+  table_.fill( ShellPairIntegralEngine::ObaraSaika );
+  if( rt.comm_rank() == 0 ) benchmark( boys_table );
+
+  #ifdef GAUXC_HAS_MPI
+  // Timings differ across ranks, the selection of rank 0 is used everywhere
+  std::array<int,std::tuple_size_v<decltype(table_)>> selection;
+  std::transform( table_.begin(), table_.end(), selection.begin(),
+    []( auto e ){ return int(e); } );
+  MPI_Bcast( selection.data(), selection.size(), MPI_INT, 0, rt.comm() );
+  std::transform( selection.begin(), selection.end(), table_.begin(),
+    []( int e ){ return ShellPairIntegralEngine(e); } );
+  #endif
+
+}
+
+void ShellPairEngineTable::benchmark( double* boys_table ) {
+
+  constexpr size_t npts   = 64;
+  constexpr int    ntrial = 3;
+
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> dist(-2., 2.);
+
+  // Grid points ( (3,npts) col major ) and their transpose for Obara-Saika
+  std::vector<double> points(3*npts), points_t(3*npts), weights(npts);
+  for( size_t i = 0; i < npts; ++i ) {
+    for( int k = 0; k < 3; ++k ) {
+      points[k + 3*i] = 2. * dist(gen);
+      points_t[i + k*npts] = points[k + 3*i];
+    }
+    weights[i] = std::abs(dist(gen));
+  }
+
+  const int max_nc = (max_l+1)*(max_l+2)/2;
+  std::vector<double> X(2*max_nc*npts), G(2*max_nc*npts), scr;
+  for( auto& x : X ) x = dist(gen);
+
+  using clock_type = std::chrono::high_resolution_clock;
+  auto time_it = [&]( auto&& f ) {
+    double t_min = std::numeric_limits<double>::infinity();
+    for( int it = 0; it < ntrial; ++it ) {
+      auto st = clock_type::now();
+      f();
+      auto en = clock_type::now();
+      t_min = std::min( t_min, std::chrono::duration<double>(en-st).count() );
+    }
+    return t_min;
+  };
+
+  const std::array<double,3> origin_a = {0.1, 0.2, -0.3};
+  const std::array<double,3> origin_b = {0.9, -0.4, 0.5};
+
+  for( int ic = 0; ic < nprim_classes; ++ic ) {
+
+    // Contractions of equal length spanning the primitive pair class
+    const int nprim = std::round( std::sqrt(double(nprim_class_bounds[ic])) );
+    Shell<double>::prim_array alpha{}, coeff{};
+    for( int i = 0; i < nprim; ++i ) {
+      alpha[i] = 10. * std::pow(0.3, i);
+      coeff[i] = 1. / nprim;
+    }
+
+    for( int la = 0; la <= max_l; ++la )
+    for( int lb = 0; lb <= la;    ++lb ) {
+
+      Shell<double> sh_a( PrimSize(nprim), AngularMomentum(la),
+        SphericalType(false), alpha, coeff, origin_a );
+      Shell<double> sh_b( PrimSize(nprim), AngularMomentum(lb),
+        SphericalType(false), alpha, coeff, origin_b );
+      ShellPair<double> sh_pair( sh_a, sh_b );
+
+      const int ncA = sh_a.cart_size();
+      const double* Xa = X.data();
+      const double* Xb = X.data() + ncA*npts;
+      double* Ga = G.data();
+      double* Gb = G.data() + ncA*npts;
+
+      XCPU::point rA{ origin_a[0], origin_a[1], origin_a[2] };
+      XCPU::point rB{ origin_b[0], origin_b[1], origin_b[2] };
+
+      const double t_os = time_it([&]() {
+        XCPU::compute_integral_shell_pair( false, npts, points_t.data(),
+          la, lb, rA, rB, sh_pair.nprim_pairs(),
+          const_cast<XCPU::prim_pair*>(sh_pair.prim_pairs()),
+          const_cast<double*>(Xa), const_cast<double*>(Xb), npts, Ga, Gb,
+          npts, weights.data(), boys_table );
+      });
+
+      const double t_rys = time_it([&]() {
+        rys_gmat_shell_pair( false, npts, points.data(), sh_a, sh_b, Xa, Xb,
+          npts, Ga, Gb, npts, weights.data(), scr );
+      });
+
+      table_[ (la*(max_l+1) + lb)*nprim_classes + ic ] = t_rys < t_os ?
+        ShellPairIntegralEngine::Rys : ShellPairIntegralEngine::ObaraSaika;
+
+    }
+  }
+
+}
+
+}
+}
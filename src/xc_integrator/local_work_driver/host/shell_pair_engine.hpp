@@ -0,0 +1,86 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include <gauxc/gauxc_config.hpp>
+#include <gauxc/enums.hpp>
+#include <gauxc/shell.hpp>
+#include <gauxc/runtime_environment.hpp>
+#include <array>
+#include <vector>
+
+namespace GauXC {
+namespace detail {
+
+/**
+ *  @brief Increment G with the contribution of a shell pair through Rys
+ *  quadrature
+ *
+ *  Ga(a,i) += w(i) * sum_b A(a,b,i) * Xb(b,i)
+ *  Gb(b,i) += w(i) * sum_a A(a,b,i) * Xa(a,i)  (if not is_diag)
+ *
+ *  Same contract as XCPU::compute_integral_shell_pair (X/G are stored
+ *  row major over Cartesian components)
+ *
+ *  @param[in]     points  Grid points ( (3,npts) col major)
+ *  @param[in/out] scr     Scratch space, resized as needed
+ *
+ *  The Rys work space is held per thread
+ */
+void rys_gmat_shell_pair( bool is_diag, size_t npts, const double* points,
+  const Shell<double>& sh_a, const Shell<double>& sh_b, const double* Xa,
+  const double* Xb, size_t ldx, double* Ga, double* Gb, size_t ldg,
+  const double* weights, std::vector<double>& scr );
+
+/**
+ *  @brief Per-class selection of the sn-LinK shell pair integral engine
+ *
+ *  The faster of Obara-Saika and Rys is determined for each
+ *  (la, lb, nprim_pair) class by a microbenchmark on rank 0, performed once
+ *  per process by initialize and broadcast such that all ranks agree.
+ */
+class ShellPairEngineTable {
+
+public:
+
+  static constexpr int max_l = GAUXC_CPU_SNLINK_MAX_AM;
+  static constexpr int nprim_classes = 6;
+
+  /// Upper bound on the number of primitive pairs for each class
+  static constexpr std::array<int,nprim_classes> nprim_class_bounds =
+    {1, 4, 9, 16, 36, 81};
+
+  /**
+   *  @brief Benchmark and broadcast the process-wide table
+   *
+   *  The first call is collective over the ranks of rt, later calls return
+   *  the existing table. Not to be called within OpenMP parallel regions.
+   */
+  static const ShellPairEngineTable& initialize( double* boys_table, 
+    const RuntimeEnvironment& rt );
+
+  /// Get the process-wide table (nullptr if not initialized)
+  static const ShellPairEngineTable* instance();
+
+  /// Engine for a (la, lb, nprim_pair) class (la >= lb)
+  ShellPairIntegralEngine select( int la, int lb, size_t nprim_pair ) const;
+
+private:
+
+  std::array<ShellPairIntegralEngine,
+    (max_l+1)*(max_l+1)*nprim_classes> table_;
+
+  ShellPairEngineTable( double* boys_table, const RuntimeEnvironment& rt );
+
+  void benchmark( double* boys_table );
+
+  static int nprim_class( size_t nprim_pair );
+
+};
+
+}
+}
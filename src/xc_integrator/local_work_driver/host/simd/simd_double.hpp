@@ -0,0 +1,121 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__AVX512F__) || defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+// Packed double precision operations for the host SIMD kernels. The vector
+// width is selected at compile time from the target ISA (-march)
+
+namespace GauXC::simd {
+
+// AVX-512 SIMD Types
+#if defined(__AVX512F__)
+
+using vdouble = __m512d;
+using vmask   = __mmask8;
+constexpr int width = 8;
+
+inline vdouble set1( double x )                   { return _mm512_set1_pd(x);   }
+inline vdouble load( const double* x )            { return _mm512_loadu_pd(x);  }
+inline void    store( double* x, vdouble y )      { _mm512_storeu_pd(x, y);     }
+
+inline vdouble add( vdouble x, vdouble y )        { return _mm512_add_pd(x, y); }
+inline vdouble sub( vdouble x, vdouble y )        { return _mm512_sub_pd(x, y); }
+inline vdouble mul( vdouble x, vdouble y )        { return _mm512_mul_pd(x, y); }
+inline vdouble div( vdouble x, vdouble y )        { return _mm512_div_pd(x, y); }
+inline vdouble min( vdouble x, vdouble y )        { return _mm512_min_pd(x, y); }
+inline vdouble max( vdouble x, vdouble y )        { return _mm512_max_pd(x, y); }
+inline vdouble sqrt( vdouble x )                  { return _mm512_sqrt_pd(x);   }
+
+inline vmask lt( vdouble x, vdouble y ) { return _mm512_cmp_pd_mask(x, y, _CMP_LT_OQ); }
+inline vmask le( vdouble x, vdouble y ) { return _mm512_cmp_pd_mask(x, y, _CMP_LE_OQ); }
+inline vmask gt( vdouble x, vdouble y ) { return _mm512_cmp_pd_mask(x, y, _CMP_GT_OQ); }
+
+inline vmask mask_and( vmask x, vmask y ) { return x & y; }
+inline vmask mask_or ( vmask x, vmask y ) { return x | y; }
+inline bool  any( vmask x )               { return x != 0;    }
+inline bool  all( vmask x )               { return x == 0xFF; }
+
+/// Select y in the lanes set in m, x otherwise
+inline vdouble select( vmask m, vdouble x, vdouble y ) {
+  return _mm512_mask_blend_pd(m, x, y);
+}
+
+// AVX-256 SIMD Types
+#elif defined(__AVX__)
+
+using vdouble = __m256d;
+using vmask   = __m256d;
+constexpr int width = 4;
+
+inline vdouble set1( double x )                   { return _mm256_set1_pd(x);   }
+inline vdouble load( const double* x )            { return _mm256_loadu_pd(x);  }
+inline void    store( double* x, vdouble y )      { _mm256_storeu_pd(x, y);     }
+
+inline vdouble add( vdouble x, vdouble y )        { return _mm256_add_pd(x, y); }
+inline vdouble sub( vdouble x, vdouble y )        { return _mm256_sub_pd(x, y); }
+inline vdouble mul( vdouble x, vdouble y )        { return _mm256_mul_pd(x, y); }
+inline vdouble div( vdouble x, vdouble y )        { return _mm256_div_pd(x, y); }
+inline vdouble min( vdouble x, vdouble y )        { return _mm256_min_pd(x, y); }
+inline vdouble max( vdouble x, vdouble y )        { return _mm256_max_pd(x, y); }
+inline vdouble sqrt( vdouble x )                  { return _mm256_sqrt_pd(x);   }
+
+inline vmask lt( vdouble x, vdouble y ) { return _mm256_cmp_pd(x, y, _CMP_LT_OQ); }
+inline vmask le( vdouble x, vdouble y ) { return _mm256_cmp_pd(x, y, _CMP_LE_OQ); }
+inline vmask gt( vdouble x, vdouble y ) { return _mm256_cmp_pd(x, y, _CMP_GT_OQ); }
+
+inline vmask mask_and( vmask x, vmask y ) { return _mm256_and_pd(x, y);          }
+inline vmask mask_or ( vmask x, vmask y ) { return _mm256_or_pd(x, y);           }
+inline bool  any( vmask x )               { return _mm256_movemask_pd(x) != 0;   }
+inline bool  all( vmask x )               { return _mm256_movemask_pd(x) == 0xF; }
+
+/// Select y in the lanes set in m, x otherwise
+inline vdouble select( vmask m, vdouble x, vdouble y ) {
+  return _mm256_blendv_pd(x, y, m);
+}
+
+// Scalar SIMD Emulation
+#else
+
+using vdouble = double;
+using vmask   = bool;
+constexpr int width = 1;
+
+inline vdouble set1( double x )                   { return x;  }
+inline vdouble load( const double* x )            { return *x; }
+inline void    store( double* x, vdouble y )      { *x = y;    }
+
+inline vdouble add( vdouble x, vdouble y )        { return x + y; }
+inline vdouble sub( vdouble x, vdouble y )        { return x - y; }
+inline vdouble mul( vdouble x, vdouble y )        { return x * y; }
+inline vdouble div( vdouble x, vdouble y )        { return x / y; }
+inline vdouble min( vdouble x, vdouble y )        { return std::min(x, y); }
+inline vdouble max( vdouble x, vdouble y )        { return std::max(x, y); }
+inline vdouble sqrt( vdouble x )                  { return std::sqrt(x);   }
+
+inline vmask lt( vdouble x, vdouble y ) { return x <  y; }
+inline vmask le( vdouble x, vdouble y ) { return x <= y; }
+inline vmask gt( vdouble x, vdouble y ) { return x >  y; }
+
+inline vmask mask_and( vmask x, vmask y ) { return x and y; }
+inline vmask mask_or ( vmask x, vmask y ) { return x or  y; }
+inline bool  any( vmask x )               { return x; }
+inline bool  all( vmask x )               { return x; }
+
+/// Select y in the lanes set in m, x otherwise
+inline vdouble select( vmask m, vdouble x, vdouble y ) { return m ? y : x; }
+
+#endif
+
+}
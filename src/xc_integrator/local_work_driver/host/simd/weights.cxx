@@ -0,0 +1,377 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "host/simd/weights.hpp"
+#include "host/simd/simd_double.hpp"
+#include "common/integrator_constants.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace GauXC {
+
+namespace {
+
+using namespace simd;
+
+/// SoA block of (up to) simd::width points of a task, padded with the last
+/// point of the block
+struct PointBlock {
+
+  vdouble x, y, z;
+  size_t  npts;
+
+  PointBlock( const XCTask& task, size_t ipt ) :
+    npts( std::min<size_t>( width, task.points.size() - ipt ) ) {
+
+    alignas(64) double px[width], py[width], pz[width];
+    for( int l = 0; l < width; ++l ) {
+      const auto& pt = task.points[ ipt + std::min<size_t>( l, npts-1 ) ];
+      px[l] = pt[0]; py[l] = pt[1]; pz[l] = pt[2];
+    }
+    x = load(px); y = load(py); z = load(pz);
+
+  }
+
+  /// Distances of the points to an atom
+  inline vdouble dist( const Atom& atom ) const {
+    const auto dx = sub( x, set1(atom.x) );
+    const auto dy = sub( y, set1(atom.y) );
+    const auto dz = sub( z, set1(atom.z) );
+    return sqrt( add( add( mul(dx,dx), mul(dy,dy) ), mul(dz,dz) ) );
+  }
+
+  /// Scale the weights of the points in the block
+  inline void scale_weights( XCTask& task, size_t ipt, vdouble factor ) const {
+    alignas(64) double f[width];
+    store( f, factor );
+    for( size_t l = 0; l < npts; ++l ) task.weights[ipt + l] *= f[l];
+  }
+
+};
+
+/// Per-atom scratch of a point block (natoms x simd::width)
+struct BlockScratch {
+
+  std::vector<double> data;
+
+  BlockScratch( size_t natoms ) : data( natoms * width ) {}
+
+  inline vdouble get( size_t i ) const { return load( data.data() + i*width ); }
+  inline void    set( size_t i, vdouble x ) { store( data.data() + i*width, x ); }
+
+};
+
+/// Distances of all atoms to the points of a block, returns the distance of
+/// the nearest atom to each point
+vdouble eval_atom_dist( const Molecule& mol, const PointBlock& block,
+  BlockScratch& atomDist ) {
+
+  vdouble r_nearest = set1( std::numeric_limits<double>::infinity() );
+  for( size_t iA = 0; iA < mol.natoms(); ++iA ) {
+    const auto r = block.dist( mol[iA] );
+    atomDist.set( iA, r );
+    r_nearest = min( r_nearest, r );
+  }
+  return r_nearest;
+
+}
+
+/// Collect the atoms within cutoff (inclusive) of any point of a block
+/// (iParent is always kept) in increasing index order, returns their number
+size_t collect_atoms( size_t natoms, int32_t iParent, const BlockScratch& atomDist,
+  vdouble cutoff, int32_t* atomList, size_t& parent_idx ) {
+
+  size_t nlist = 0;
+  for( size_t iA = 0; iA < natoms; ++iA )
+  if( (int32_t)iA == iParent or any( le( atomDist.get(iA), cutoff ) ) ) {
+    if( (int32_t)iA == iParent ) parent_idx = nlist;
+    atomList[nlist++] = iA;
+  }
+  return nlist;
+
+}
+
+/// Inverse interatomic distances (cut at R_max)
+std::vector<double> inverse_rab( const MolMeta& meta, double R_max ) {
+  const auto& RAB = meta.rab();
+  std::vector<double> RABinv( RAB.size(), 0. );
+  for( size_t i = 0; i < RAB.size(); ++i )
+    if( RAB[i] > 0. ) RABinv[i] = 1. / std::min( RAB[i], R_max );
+  return RABinv;
+}
+
+/// Becke cell function, s(mu) = (1 - f_3(mu)) / 2
+inline vdouble becke_cell( vdouble mu ) {
+  auto hBecke = [](vdouble x) { // Eq. 19
+    return mul( x, sub( set1(1.5), mul( set1(0.5), mul(x,x) ) ) );
+  };
+  return mul( set1(0.5), sub( set1(1.), hBecke(hBecke(hBecke(mu))) ) );
+}
+
+/// SSF cell function, mu is clamped to [-a,a] on which g(+-a) = +-1
+inline vdouble ssf_cell( vdouble mu ) {
+  constexpr double a = integrator::magic_ssf_factor<>;
+  const auto s_x  = div( max( set1(-a), min( set1(a), mu ) ), set1(a) );
+  const auto s_x2 = mul( s_x, s_x );
+
+  // g = s (35 - 35 s^2 + 21 s^4 - 5 s^6) / 16
+  auto g = sub( set1(21.), mul( set1(5.), s_x2 ) );
+  g = add( set1(-35.), mul( s_x2, g ) );
+  g = add( set1( 35.), mul( s_x2, g ) );
+  g = mul( mul( s_x, g ), set1(1./16.) );
+
+  return mul( set1(0.5), sub( set1(1.), g ) );
+}
+
+}
+
+
+
+void simd_becke_weights_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  task_iterator          task_begin,
+  task_iterator          task_end,
+  bool                   neighbor_list
+) {
+
+  const size_t ntasks = std::distance(task_begin,task_end);
+  const size_t natoms = mol.natoms();
+
+  const auto RABinv = inverse_rab( meta,
+    std::numeric_limits<double>::infinity() );
+
+  // Atoms beyond becke_neighbor_ratio * r_nearest of all points of a block
+  // are screened if requested
+  const double ratio = neighbor_list ? integrator::becke_neighbor_ratio :
+    std::numeric_limits<double>::infinity();
+
+  #pragma omp parallel
+  {
+
+  BlockScratch         partitionScratch( natoms );
+  BlockScratch         atomDist( natoms );
+  std::vector<int32_t> atomList( natoms );
+
+  #pragma omp for schedule(dynamic)
+  for( size_t iT = 0; iT < ntasks; ++iT ) {
+
+    auto& task = *(task_begin+iT);
+    const auto npts = task.points.size();
+
+  for( size_t ipt = 0; ipt < npts; ipt += width ) {
+
+    PointBlock block( task, ipt );
+
+    const auto r_nearest = eval_atom_dist( mol, block, atomDist );
+    size_t parent_idx = 0;
+    const auto nlist = collect_atoms( natoms, task.iParent, atomDist,
+      mul( set1(ratio), r_nearest ), atomList.data(), parent_idx );
+
+    // Evaluate unnormalized partition functions
+    for( size_t i = 0; i < nlist; ++i ) partitionScratch.set( i, set1(1.) );
+    for( size_t i = 0; i < nlist; ++i )
+    for( size_t j = 0; j < i;     ++j ) {
+      const auto iA = atomList[i];
+      const auto jA = atomList[j];
+
+      const auto mu = mul( sub( atomDist.get(iA), atomDist.get(jA) ),
+        set1( RABinv[jA + iA*natoms] ) );
+      const auto s  = becke_cell( mu );
+
+      partitionScratch.set( i, mul( partitionScratch.get(i), s ) );
+      partitionScratch.set( j, 
+        mul( partitionScratch.get(j), sub( set1(1.), s ) ) );
+    }
+
+    // Normalization
+    vdouble sum = set1(0.);
+    for( size_t i = 0; i < nlist; ++i ) sum = add( sum, partitionScratch.get(i) );
+
+    // Update Weights
+    block.scale_weights( task, ipt, div( partitionScratch.get(parent_idx), sum ) );
+
+  } // Loop over point blocks
+  } // Loop over tasks
+
+  } // OMP context
+
+}
+
+void simd_ssf_weights_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  task_iterator          task_begin,
+  task_iterator          task_end
+) {
+
+  const size_t ntasks = std::distance(task_begin,task_end);
+  const size_t natoms = mol.natoms();
+
+  const auto RABinv = inverse_rab( meta,
+    std::numeric_limits<double>::infinity() );
+
+  // Atoms beyond q^2 * r_nearest, q = (1+a)/(1-a), do not contribute to the
+  // SSF partition functions (see reference_ssf_weights_nl_host)
+  constexpr double a = integrator::magic_ssf_factor<>;
+  constexpr double q = (1. + a) / (1. - a);
+
+  #pragma omp parallel
+  {
+
+  BlockScratch         partitionScratch( natoms );
+  BlockScratch         atomDist( natoms );
+  std::vector<int32_t> atomList( natoms );
+
+  #pragma omp for schedule(dynamic)
+  for( size_t iT = 0; iT < ntasks; ++iT ) {
+
+    auto& task = *(task_begin+iT);
+    const auto npts = task.points.size();
+    const auto dist_cutoff = set1( 0.5 * (1-a) * task.dist_nearest );
+
+  for( size_t ipt = 0; ipt < npts; ipt += width ) {
+
+    PointBlock block( task, ipt );
+
+    // Partition weight = 1 for all points
+    const auto inner = lt( block.dist( mol[task.iParent] ), dist_cutoff );
+    if( all(inner) ) continue;
+
+    const auto r_nearest = eval_atom_dist( mol, block, atomDist );
+    size_t parent_idx = 0;
+    const auto nlist = collect_atoms( natoms, task.iParent, atomDist,
+      mul( set1(q*q), r_nearest ), atomList.data(), parent_idx );
+
+    // Evaluate unnormalized partition functions
+    const auto tol = set1( integrator::ssf_weight_tol );
+    for( size_t i = 0; i < nlist; ++i ) partitionScratch.set( i, set1(1.) );
+    for( size_t i = 0; i < nlist; ++i )
+    for( size_t j = 0; j < i;     ++j ) {
+
+      const auto p_i = partitionScratch.get(i);
+      const auto p_j = partitionScratch.get(j);
+      const auto active = mask_or( gt( p_i, tol ), gt( p_j, tol ) );
+      if( not any(active) ) continue;
+
+      const auto iA = atomList[i];
+      const auto jA = atomList[j];
+
+      const auto mu = mul( sub( atomDist.get(iA), atomDist.get(jA) ),
+        set1( RABinv[jA + iA*natoms] ) );
+      const auto s  = ssf_cell( mu );
+
+      partitionScratch.set( i, select( active, p_i, mul( p_i, s ) ) );
+      partitionScratch.set( j, select( active, p_j,
+        mul( p_j, sub( set1(1.), s ) ) ) );
+
+    }
+
+    // Normalization
+    vdouble sum = set1(0.);
+    for( size_t i = 0; i < nlist; ++i ) sum = add( sum, partitionScratch.get(i) );
+
+    // Update Weights
+    const auto factor = div( partitionScratch.get(parent_idx), sum );
+    block.scale_weights( task, ipt, select( inner, factor, set1(1.) ) );
+
+  } // Loop over point blocks
+  } // Loop over tasks
+
+  } // OMP context
+
+}
+
+void simd_lko_weights_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  task_iterator          task_begin,
+  task_iterator          task_end
+) {
+
+  // Sort on atom index, the task order is that of reference_lko_weights_host
+  std::stable_sort( task_begin, task_end, 
+    [](const auto& a, const auto&b ) { return a.iParent < b.iParent; } );
+
+  const size_t ntasks = std::distance(task_begin,task_end);
+  const size_t natoms = mol.natoms();
+
+  // Same cutoff as reference_lko_weights_host. Only the atoms within R_cutoff
+  // of the nearest atom to a point contribute, the pair factors are symmetric
+  // (s(-mu) = 1 - s(mu)) such that the distance ordering of the reference
+  // kernel is not required
+  constexpr double R_cutoff = 5;
+  const auto RABinv = inverse_rab( meta, R_cutoff );
+
+  #pragma omp parallel
+  {
+
+  BlockScratch         partitionScratch( natoms );
+  BlockScratch         atomDist( natoms );
+  std::vector<int32_t> atomList( natoms );
+
+  #pragma omp for schedule(dynamic)
+  for( size_t iT = 0; iT < ntasks; ++iT ) {
+
+    auto& task = *(task_begin+iT);
+    const auto npts = task.points.size();
+
+  for( size_t ipt = 0; ipt < npts; ipt += width ) {
+
+    PointBlock block( task, ipt );
+
+    const auto r_nearest = eval_atom_dist( mol, block, atomDist );
+    const auto r_cutoff  = add( r_nearest, set1(R_cutoff) );
+
+    size_t parent_idx = 0;
+    const auto nlist = collect_atoms( natoms, task.iParent, atomDist,
+      r_cutoff, atomList.data(), parent_idx );
+
+    // Evaluate unnormalized partition functions, vanishing for the atoms
+    // beyond the cutoff
+    for( size_t i = 0; i < nlist; ++i )
+      partitionScratch.set( i, 
+        select( le( atomDist.get(atomList[i]), r_cutoff ), set1(0.), set1(1.) ) );
+
+    for( size_t i = 0; i < nlist; ++i )
+    for( size_t j = 0; j < i;     ++j ) {
+      const auto iA = atomList[i];
+      const auto jA = atomList[j];
+
+      const auto active = mask_and( le( atomDist.get(iA), r_cutoff ),
+                                    le( atomDist.get(jA), r_cutoff ) );
+      if( not any(active) ) continue;
+
+      const auto p_i = partitionScratch.get(i);
+      const auto p_j = partitionScratch.get(j);
+
+      const auto mu = mul( sub( atomDist.get(iA), atomDist.get(jA) ),
+        set1( RABinv[jA + iA*natoms] ) );
+      const auto s  = becke_cell( mu );
+
+      partitionScratch.set( i, select( active, p_i, mul( p_i, s ) ) );
+      partitionScratch.set( j, select( active, p_j,
+        mul( p_j, sub( set1(1.), s ) ) ) );
+    }
+
+    // Normalization
+    vdouble sum = set1(0.);
+    for( size_t i = 0; i < nlist; ++i ) sum = add( sum, partitionScratch.get(i) );
+
+    // Update Weights
+    block.scale_weights( task, ipt, div( partitionScratch.get(parent_idx), sum ) );
+
+  } // Loop over point blocks
+  } // Loop over tasks
+
+  } // OMP context
+
+}
+
+}
@@ -0,0 +1,34 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "host/simd_local_host_work_driver.hpp"
+#include "host/simd/weights.hpp"
+#include <gauxc/exceptions.hpp>
+
+namespace GauXC {
+
+  // Partition weights
+  void SIMDLocalHostWorkDriver::partition_weights( XCWeightAlg weight_alg, 
+    const Molecule& mol, const MolMeta& meta, task_iterator task_begin, 
+    task_iterator task_end, bool neighbor_list ) {
+    switch( weight_alg ) {
+      case XCWeightAlg::Becke:
+        simd_becke_weights_host( mol, meta, task_begin, task_end,
+          neighbor_list );
+        break;
+      case XCWeightAlg::SSF:
+        simd_ssf_weights_host( mol, meta, task_begin, task_end );
+        break;
+      case XCWeightAlg::LKO:
+        simd_lko_weights_host( mol, meta, task_begin, task_end );
+        break;
+      default:
+        GAUXC_GENERIC_EXCEPTION("Weight Alg Not Supported");
+    }
+  }
+
+}
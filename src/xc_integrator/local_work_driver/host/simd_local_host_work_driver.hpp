@@ -0,0 +1,32 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include "reference_local_host_work_driver.hpp"
+
+namespace GauXC {
+
+/// Host LWD which evaluates the partition weights over SIMD blocks of
+/// quadrature points, all other kernels are those of the reference LWD
+struct SIMDLocalHostWorkDriver : public ReferenceLocalHostWorkDriver {
+
+  SIMDLocalHostWorkDriver() = default;
+
+  virtual ~SIMDLocalHostWorkDriver() noexcept = default;
+
+  SIMDLocalHostWorkDriver( const SIMDLocalHostWorkDriver& )     = delete;
+  SIMDLocalHostWorkDriver( SIMDLocalHostWorkDriver&& ) noexcept = delete;
+
+  // Public APIs
+
+  void partition_weights( XCWeightAlg weight_alg, const Molecule& mol, 
+    const MolMeta& meta, task_iterator task_begin, task_iterator task_end,
+    bool neighbor_list ) override;
+
+};
+
+}
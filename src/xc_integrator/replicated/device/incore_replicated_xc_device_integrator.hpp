@@ -90,12 +90,27 @@ protected:
                           value_type* elec_EXC,  value_type* prot_EXC,  const IntegratorSettingsXC& settings ) override;
 
   void eval_exc_grad_( int64_t m, int64_t n, const value_type* P,
-                       int64_t ldp, value_type* EXC_GRAD ) override;
+                       int64_t ldp, value_type* EXC_GRAD, 
+                       const IntegratorSettingsXC& ks_settings ) override;
 
   void eval_exx_( int64_t m, int64_t n, const value_type* P,
                   int64_t ldp, value_type* K, int64_t ldk,
                   const IntegratorSettingsEXX& settings ) override;
 
+  void eval_exx_energy_( int64_t m, int64_t n, const value_type* P,
+                         int64_t ldp, value_type* EXX,
+                         const IntegratorSettingsEXX& settings ) override;
+
+  void eval_coulomb_( int64_t m, int64_t n, const value_type* P,
+                      int64_t ldp, value_type* J, int64_t ldj,
+                      const IntegratorSettingsCoulomb& settings ) override;
+
+  void eval_coulomb_exx_( int64_t m, int64_t n, const value_type* P,
+                          int64_t ldp, value_type* J, int64_t ldj,
+                          value_type* K, int64_t ldk,
+                          const IntegratorSettingsCoulomb& cou_settings,
+                          const IntegratorSettingsEXX& exx_settings ) override;
+
 
   void integrate_den_local_work_( const basis_type& basis, const value_type* P, int64_t ldp, 
                             value_type *N_EL,
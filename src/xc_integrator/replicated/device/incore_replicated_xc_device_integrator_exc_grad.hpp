@@ -17,7 +17,8 @@ namespace detail {
 template <typename ValueType>
 void IncoreReplicatedXCDeviceIntegrator<ValueType>::
   eval_exc_grad_( int64_t m, int64_t n, const value_type* P,
-                 int64_t ldp, value_type* EXC_GRAD ) { 
+                 int64_t ldp, value_type* EXC_GRAD, 
+                 const IntegratorSettingsXC& ks_settings ) { 
                  
   const auto& basis = this->load_balancer_->basis();
 
@@ -30,6 +31,11 @@ void IncoreReplicatedXCDeviceIntegrator<ValueType>::
   if( ldp < nbf )
     GAUXC_GENERIC_EXCEPTION("Invalid LDP");
 
+  if( auto* tmp = dynamic_cast<const IntegratorSettingsKS*>(&ks_settings) ) {
+    if( tmp->weight_derivatives )
+      GAUXC_GENERIC_EXCEPTION("Weight Derivatives NYI for Device Integration");
+  }
+
   // Get Tasks
   auto& tasks = this->load_balancer_->get_tasks();
 
@@ -20,6 +20,35 @@
 namespace GauXC  {
 namespace detail {
 
+template <typename ValueType>
+void IncoreReplicatedXCDeviceIntegrator<ValueType>::
+  eval_exx_energy_( int64_t m, int64_t n, const value_type* P,
+                    int64_t ldp, value_type* EXX, 
+                    const IntegratorSettingsEXX& settings ) { 
+  GauXC::util::unused(m,n,P,ldp,EXX,settings);
+  GAUXC_GENERIC_EXCEPTION("EXX ENERGY NOT YET IMPLEMENTED FOR DEVICE");
+}
+
+template <typename ValueType>
+void IncoreReplicatedXCDeviceIntegrator<ValueType>::
+  eval_coulomb_( int64_t m, int64_t n, const value_type* P,
+                 int64_t ldp, value_type* J, int64_t ldj, 
+                 const IntegratorSettingsCoulomb& settings ) { 
+  GauXC::util::unused(m,n,P,ldp,J,ldj,settings);
+  GAUXC_GENERIC_EXCEPTION("sn-J NOT YET IMPLEMENTED FOR DEVICE");
+}
+
+template <typename ValueType>
+void IncoreReplicatedXCDeviceIntegrator<ValueType>::
+  eval_coulomb_exx_( int64_t m, int64_t n, const value_type* P,
+                     int64_t ldp, value_type* J, int64_t ldj, 
+                     value_type* K, int64_t ldk, 
+                     const IntegratorSettingsCoulomb& cou_settings,
+                     const IntegratorSettingsEXX& exx_settings ) { 
+  GauXC::util::unused(m,n,P,ldp,J,ldj,K,ldk,cou_settings,exx_settings);
+  GAUXC_GENERIC_EXCEPTION("sn-J NOT YET IMPLEMENTED FOR DEVICE");
+}
+
 template <typename ValueType>
 void IncoreReplicatedXCDeviceIntegrator<ValueType>::
   eval_exx_( int64_t m, int64_t n, const value_type* P,
@@ -11,6 +11,7 @@
 #include "reference_replicated_xc_host_integrator_exc_vxc_neo.hpp"
 #include "reference_replicated_xc_host_integrator_exc_grad.hpp"
 #include "reference_replicated_xc_host_integrator_exx.hpp"
+#include "reference_replicated_xc_host_integrator_coulomb.hpp"
  
 namespace GauXC::detail {
 
@@ -8,6 +8,7 @@
 #pragma once
 #include <gauxc/xc_integrator/replicated/replicated_xc_host_integrator.hpp>
 #include "xc_host_data.hpp"
+#include <gauxc/basisset_map.hpp>
 
 namespace GauXC::detail {
 
@@ -24,6 +25,7 @@ public:
   using basis_type = typename base_type::basis_type;
   using task_container = std::vector<XCTask>;
   using task_iterator  = typename task_container::iterator;
+  using const_task_iterator = typename task_container::const_iterator;
 
 
 protected:
@@ -92,14 +94,37 @@ protected:
 
   /// RKS EXC Gradient
   void eval_exc_grad_( int64_t m, int64_t n, const value_type* P,
-                       int64_t ldp, value_type* EXC_GRAD ) override;
+                       int64_t ldp, value_type* EXC_GRAD, 
+                       const IntegratorSettingsXC& ks_settings ) override;
 
   /// sn-LinK
   void eval_exx_( int64_t m, int64_t n, const value_type* P,
                   int64_t ldp, value_type* K, int64_t ldk,
                   const IntegratorSettingsEXX& settings ) override;
 
+  /// sn-LinK energy only
+  void eval_exx_energy_( int64_t m, int64_t n, const value_type* P,
+                         int64_t ldp, value_type* EXX,
+                         const IntegratorSettingsEXX& settings ) override;
 
+  /// sn-J
+  void eval_coulomb_( int64_t m, int64_t n, const value_type* P,
+                      int64_t ldp, value_type* J, int64_t ldj,
+                      const IntegratorSettingsCoulomb& settings ) override;
+
+  /// sn-J + sn-LinK
+  void eval_coulomb_exx_( int64_t m, int64_t n, const value_type* P,
+                          int64_t ldp, value_type* J, int64_t ldj,
+                          value_type* K, int64_t ldk,
+                          const IntegratorSettingsCoulomb& cou_settings,
+                          const IntegratorSettingsEXX& exx_settings ) override;
+
+
+  // Local tasks in the given order (decreasing size or along a space filling
+  // curve). The load balancer tasks are only reordered (invalidating data
+  // cached on their generation) if they are not yet in this order
+  const task_container& get_ordered_tasks_( TaskOrdering ordering );
+  const task_container& get_ordered_tasks_( const IntegratorSettingsXC& settings );
 
   // Implementation details of integrate_den
   void integrate_den_local_work_( const value_type* P, int64_t ldp, 
@@ -115,7 +140,7 @@ protected:
                             value_type* VXCy, int64_t ldvxcy,
                             value_type* VXCx, int64_t ldvxcx,
                             value_type* EXC, value_type *N_EL, const IntegratorSettingsXC& ks_settings,
-                            task_iterator task_begin, task_iterator task_end );
+                            const_task_iterator task_begin, const_task_iterator task_end );
 
   void neo_exc_vxc_local_work_( const value_type* Ps, int64_t ldps,
                                 const value_type* Pz, int64_t ldpz,
@@ -128,14 +153,38 @@ protected:
                                 value_type* EXC1, value_type* prot_EXC, 
                                 value_type *N_EL, value_type *N_PROT,
                                 const IntegratorSettingsXC& ks_settings,
-                                task_iterator task_begin, task_iterator task_end );
+                                const_task_iterator task_begin, const_task_iterator task_end );
                             
   // Implemetation details of exc_grad
-  void exc_grad_local_work_( const value_type* P, int64_t ldp, value_type* EXC_GRAD );
-
-  // Implementation details of sn-LinK
-  void exx_local_work_( const value_type* P, int64_t ldp, value_type* K, int64_t ldk,
-    const IntegratorSettingsEXX& settings );
+  void exc_grad_local_work_( const value_type* P, int64_t ldp, value_type* EXC_GRAD,
+                             const IntegratorSettingsXC& settings );
+
+  // Implementation details of sn-J / sn-LinK (J, K or EXX may be null)
+  //   EXX = tr(P K) is accumulated without forming K
+  void coulomb_exx_local_work_( const value_type* P, int64_t ldp, 
+    value_type* J, int64_t ldj, value_type* K, int64_t ldk, value_type* EXX,
+    const IntegratorSettingsCoulomb& cou_settings,
+    const IntegratorSettingsEXX& exx_settings );
+
+  // Merged and ek screened copy of the load balancer tasks for sn-LinK.
+  // The merged tasks are reused until the load balancer tasks change, their
+  // ek screening until P or the screening tolerances change
+  struct exx_task_view {
+    std::vector<XCTask>     tasks;
+    std::vector<std::vector<size_t>> src; // LB task indices of each task
+    size_t ntasks_src = 0;
+    size_t npts_src   = 0;
+    size_t generation = 0; // LoadBalancer::generation of the source tasks
+    std::vector<value_type> P; // Density of the ek screening
+    double eps_E      = -1.;
+    double eps_K      = -1.;
+  };
+  exx_task_view exx_view_;
+
+  // Return the sn-LinK task view, rebuilding it if necessary
+  const std::vector<XCTask>& get_exx_task_view_( const value_type* P, 
+    int64_t ldp, const BasisSetMap& basis_map, const double* V_max, 
+    double eps_E, double eps_K );
 
 public:
 
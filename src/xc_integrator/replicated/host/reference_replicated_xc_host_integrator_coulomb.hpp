@@ -0,0 +1,116 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include "reference_replicated_xc_host_integrator.hpp"
+#include "reference_replicated_xc_host_integrator_exx.hpp"
+
+namespace GauXC::detail {
+
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  eval_coulomb_( int64_t m, int64_t n, const value_type* P,
+                 int64_t ldp, value_type* J, int64_t ldj,
+                 const IntegratorSettingsCoulomb& settings ) {
+
+  const auto& basis = this->load_balancer_->basis();
+
+  // Check that P / J are sane
+  const int64_t nbf = basis.nbf();
+  if( m != n ) 
+    GAUXC_GENERIC_EXCEPTION("P/J Must Be Square");
+  if( m != nbf ) 
+    GAUXC_GENERIC_EXCEPTION("P/J Must Have Same Dimension as Basis");
+  if( ldp < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDP");
+  if( ldj < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDJ");
+
+
+  // Generate Tasks
+  if( not this->load_balancer_->tasks_generated() ) 
+    this->load_balancer_->get_tasks();
+
+  // Compute Local contributions to J
+  this->timer_.time_op("XCIntegrator.LocalWork", [&](){
+    coulomb_exx_local_work_( P, ldp, J, ldj, nullptr, 0, nullptr, settings,
+      IntegratorSettingsEXX{} );
+  });
+
+  #ifdef GAUXC_HAS_MPI
+  this->timer_.time_op("XCIntegrator.LocalWait", [&](){
+    MPI_Barrier( this->load_balancer_->runtime().comm() );
+  });
+  #endif
+
+  // Reduce Results
+  this->timer_.time_op("XCIntegrator.Allreduce", [&](){
+
+    if( not this->reduction_driver_->takes_host_memory() )
+      GAUXC_GENERIC_EXCEPTION("This Module Only Works With Host Reductions");
+
+    this->reduction_driver_->allreduce_inplace( J, nbf*nbf, ReductionOp::Sum );
+
+  });
+
+}
+
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  eval_coulomb_exx_( int64_t m, int64_t n, const value_type* P,
+                     int64_t ldp, value_type* J, int64_t ldj,
+                     value_type* K, int64_t ldk,
+                     const IntegratorSettingsCoulomb& cou_settings,
+                     const IntegratorSettingsEXX& exx_settings ) {
+
+  const auto& basis = this->load_balancer_->basis();
+
+  // Check that P / J / K are sane
+  const int64_t nbf = basis.nbf();
+  if( m != n ) 
+    GAUXC_GENERIC_EXCEPTION("P/J/K Must Be Square");
+  if( m != nbf ) 
+    GAUXC_GENERIC_EXCEPTION("P/J/K Must Have Same Dimension as Basis");
+  if( ldp < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDP");
+  if( ldj < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDJ");
+  if( ldk < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDK");
+
+
+  // Generate Tasks
+  if( not this->load_balancer_->tasks_generated() ) 
+    this->load_balancer_->get_tasks();
+
+  // Compute Local contributions to J / K sharing collocation
+  this->timer_.time_op("XCIntegrator.LocalWork", [&](){
+    coulomb_exx_local_work_( P, ldp, J, ldj, K, ldk, nullptr, cou_settings,
+      exx_settings );
+  });
+
+  #ifdef GAUXC_HAS_MPI
+  this->timer_.time_op("XCIntegrator.LocalWait", [&](){
+    MPI_Barrier( this->load_balancer_->runtime().comm() );
+  });
+  #endif
+
+  // Reduce Results
+  this->timer_.time_op("XCIntegrator.Allreduce", [&](){
+
+    if( not this->reduction_driver_->takes_host_memory() )
+      GAUXC_GENERIC_EXCEPTION("This Module Only Works With Host Reductions");
+
+    this->reduction_driver_->allreduce_inplace( J, nbf*nbf, ReductionOp::Sum );
+    this->reduction_driver_->allreduce_inplace( K, nbf*nbf, ReductionOp::Sum );
+
+  });
+
+}
+
+} // namespace GauXC::detail
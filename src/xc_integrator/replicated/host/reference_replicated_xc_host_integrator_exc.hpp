@@ -42,8 +42,8 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     GAUXC_GENERIC_EXCEPTION("Invalid LDPX");
 
 
-  // Get Tasks
-  auto& tasks = this->load_balancer_->get_tasks();
+  // Get Tasks (reordered only if necessary)
+  const auto& tasks = get_ordered_tasks_( ks_settings );
 
   // Temporary electron count to judge integrator accuracy
   value_type N_EL;
@@ -18,7 +18,8 @@ namespace GauXC::detail {
 template <typename ValueType>
 void ReferenceReplicatedXCHostIntegrator<ValueType>::
   eval_exc_grad_( int64_t m, int64_t n, const value_type* P,
-                 int64_t ldp, value_type* EXC_GRAD ) { 
+                 int64_t ldp, value_type* EXC_GRAD, 
+                 const IntegratorSettingsXC& ks_settings ) { 
                  
                  
   const auto& basis = this->load_balancer_->basis();
@@ -33,12 +34,13 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     GAUXC_GENERIC_EXCEPTION("Invalid LDP");
                  
                  
-  // Get Tasks
-  this->load_balancer_->get_tasks();
+  // Generate Tasks
+  if( not this->load_balancer_->tasks_generated() ) 
+    this->load_balancer_->get_tasks();
                  
   // Compute Local contributions to EXC / VXC
   this->timer_.time_op("XCIntegrator.LocalWork", [&](){
-    exc_grad_local_work_( P, ldp, EXC_GRAD );
+    exc_grad_local_work_( P, ldp, EXC_GRAD, ks_settings );
   });
 
 
@@ -56,7 +58,8 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
 template <typename ValueType>
 void ReferenceReplicatedXCHostIntegrator<ValueType>::
-  exc_grad_local_work_( const value_type* P, int64_t ldp, value_type* EXC_GRAD ) {
+  exc_grad_local_work_( const value_type* P, int64_t ldp, value_type* EXC_GRAD,
+    const IntegratorSettingsXC& settings ) {
 
   // Cast LWD to LocalHostWorkDriver
   auto* lwd = dynamic_cast<LocalHostWorkDriver*>(this->local_work_driver_.get());
@@ -66,6 +69,12 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   const auto& basis = this->load_balancer_->basis();
   const auto& mol   = this->load_balancer_->molecule();
 
+  // Misc KS settings
+  IntegratorSettingsKS ks_settings;
+  if( auto* tmp = dynamic_cast<const IntegratorSettingsKS*>(&settings) ) {
+    ks_settings = *tmp;
+  }
+
   // MGGA constants
   const size_t mmga_dim_scal = func.is_mgga() ? 4 : 1;
   const bool needs_laplacian = func.is_mgga() ? true : false; // TODO: Check for Laplacian dependence
@@ -77,12 +86,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   const int32_t natoms = mol.natoms();
 
   // Sort tasks on size (XXX: maybe doesnt matter?)
-  auto task_comparator = []( const XCTask& a, const XCTask& b ) {
-    return (a.points.size() * a.bfn_screening.nbe) > (b.points.size() * b.bfn_screening.nbe);
-  };
-
-  auto& tasks = this->load_balancer_->get_tasks();
-  std::sort( tasks.begin(), tasks.end(), task_comparator );
+  const auto& tasks = get_ordered_tasks_( TaskOrdering::Size );
 
 
   // Check that Partition Weights have been calculated
@@ -91,13 +95,28 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     GAUXC_GENERIC_EXCEPTION("Weights Have Not Been Modified"); 
   }
 
+  const bool weight_derivatives = ks_settings.weight_derivatives;
+  if( weight_derivatives and lb_state.weight_alg == XCWeightAlg::LKO ) {
+    GAUXC_GENERIC_EXCEPTION("Weight Derivatives NYI for LKO Weights");
+  }
+
+  // Offsets of the tasks into the XC energy density (eps * den) needed for
+  // the weight derivatives
+  const size_t ntasks = tasks.size();
+  std::vector<size_t> task_offset( ntasks + 1, 0 );
+  std::vector<value_type> exc_density;
+  if( weight_derivatives ) {
+    for( size_t iT = 0; iT < ntasks; ++iT )
+      task_offset[iT+1] = task_offset[iT] + tasks[iT].points.size();
+    exc_density.resize( task_offset[ntasks] );
+  }
+
   // Zero out integrands
   for( auto i = 0; i < 3*natoms; ++i ) {
     EXC_GRAD[i] = 0.;
   }
 
   // Loop over tasks
-  const size_t ntasks = tasks.size();
   #pragma omp parallel
   {
 
@@ -330,8 +349,15 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     else
       func.eval_exc_vxc( npts, den_eval, eps, vrho );
 
+    if( weight_derivatives ) {
+      auto* exc_density_task = exc_density.data() + task_offset[iT];
+      for( int32_t i = 0; i < npts; ++i )
+        exc_density_task[i] = eps[i] * den_eval[i];
+    }
+
 
     // Increment EXC Gradient
+    double g_task_x(0), g_task_y(0), g_task_z(0);
     size_t bf_off = 0;
     for( auto ish = 0; ish < nshells; ++ish ) {
       const int sh_idx = shell_list[ish];
@@ -437,14 +463,36 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
       #pragma omp atomic
       EXC_GRAD[3*iAt + 2] += -2 * g_acc_z;
 
+      g_task_x += -2 * g_acc_x;
+      g_task_y += -2 * g_acc_y;
+      g_task_z += -2 * g_acc_z;
+
       bf_off += sh_sz; // Increment basis offset
 
     } // End loop over shells 
+
+    // The quadrature points move along with their parent atom: the basis
+    // terms sum to minus the derivative w.r.t. the point positions
+    if( weight_derivatives ) {
+      #pragma omp atomic
+      EXC_GRAD[3*task.iParent + 0] -= g_task_x;
+      #pragma omp atomic
+      EXC_GRAD[3*task.iParent + 1] -= g_task_y;
+      #pragma omp atomic
+      EXC_GRAD[3*task.iParent + 2] -= g_task_z;
+    }
         
   } // End loop over tasks
 
   } // OpenMP Region
 
+  // Partition weight derivatives
+  if( weight_derivatives ) {
+    lwd->partition_weights_gradient( lb_state.weight_alg, mol, 
+      this->load_balancer_->molmeta(), tasks.begin(), tasks.end(), 
+      exc_density.data(), EXC_GRAD );
+  }
+
   
 }
 
@@ -9,12 +9,55 @@
 
 #include "reference_replicated_xc_host_integrator.hpp"
 #include "integrator_util/integrator_common.hpp"
+#include "integrator_util/task_ordering.hpp"
+#include "integrator_util/distributed_task_queue.hpp"
 #include "host/local_host_work_driver.hpp"
 #include "host/blas.hpp"
 #include <stdexcept>
+#include <memory>
+#include <utility>
 
 namespace GauXC::detail {
 
+template <typename ValueType>
+const typename ReferenceReplicatedXCHostIntegrator<ValueType>::task_container& 
+  ReferenceReplicatedXCHostIntegrator<ValueType>::
+  get_ordered_tasks_( TaskOrdering ordering ) {
+
+  // Generate Tasks
+  auto& lb = *this->load_balancer_;
+  if( not lb.tasks_generated() ) lb.get_tasks();
+  const auto& tasks = std::as_const(lb).get_tasks();
+
+  // Stable orderings: the permutation is the identity for ordered tasks
+  std::vector<size_t> perm;
+  if( ordering == TaskOrdering::Size ) {
+    perm.resize( tasks.size() );
+    std::iota( perm.begin(), perm.end(), 0 );
+    std::stable_sort( perm.begin(), perm.end(), [&]( auto i, auto j ) {
+      return tasks[i].points.size() * tasks[i].bfn_screening.nbe > 
+             tasks[j].points.size() * tasks[j].bfn_screening.nbe;
+    });
+  } else perm = space_filling_curve_order( tasks.begin(), tasks.end(), ordering );
+
+  lb.reorder_tasks( perm );
+  return tasks;
+
+}
+
+template <typename ValueType>
+const typename ReferenceReplicatedXCHostIntegrator<ValueType>::task_container& 
+  ReferenceReplicatedXCHostIntegrator<ValueType>::
+  get_ordered_tasks_( const IntegratorSettingsXC& settings ) {
+
+  IntegratorSettingsKS ks_settings;
+  if( auto* tmp = dynamic_cast<const IntegratorSettingsKS*>(&settings) ) {
+    ks_settings = *tmp;
+  }
+  return get_ordered_tasks_( ks_settings.task_ordering );
+
+}
+
 /**
  *  Generic implementation of EXC/VXC for RKS/UKS/GKS
  *  
@@ -62,8 +105,8 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   if( ldvxcx and ldvxcx < nbf )
     GAUXC_GENERIC_EXCEPTION("Invalid LDVXCY");
 
-  // Get Tasks
-  auto& tasks = this->load_balancer_->get_tasks();
+  // Get Tasks (reordered only if necessary)
+  const auto& tasks = get_ordered_tasks_( ks_settings );
 
   // Temporary electron count to judge integrator accuracy
   value_type N_EL;
@@ -111,7 +154,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
                        value_type* VXCx, int64_t ldvxcx,
                        value_type* EXC, value_type *N_EL, 
                        const IntegratorSettingsXC& settings,
-                       task_iterator task_begin, task_iterator task_end) {
+                       const_task_iterator task_begin, const_task_iterator task_end) {
 
   const bool is_gks = (Pz != nullptr) and (Py != nullptr) and (Px != nullptr);
   const bool is_uks = (Pz != nullptr) and (Py == nullptr) and (Px == nullptr);
@@ -150,13 +193,8 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
   const int32_t nbf = basis.nbf();
 
-  // Sort tasks on size (XXX: maybe doesnt matter?)
-  auto task_comparator = []( const XCTask& a, const XCTask& b ) {
-    return (a.points.size() * a.bfn_screening.nbe) > (b.points.size() * b.bfn_screening.nbe);
-  };
-
-  auto& tasks = this->load_balancer_->get_tasks();
-  std::sort( task_begin, task_end, task_comparator );
+  // The tasks are ordered by the caller (see get_ordered_tasks_)
+  const bool sfc_order = ks_settings.task_ordering != TaskOrdering::Size;
 
 
   // Check that Partition Weights have been calculated
@@ -194,21 +232,69 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   double EXC_WORK = 0.0;
   double NEL_WORK = 0.0;
     
+  // Chunks of tasks to process: the local tasks, or with inter-rank work
+  // stealing, chunks of the local tasks followed by tasks stolen from other
+  // ranks
+  #ifdef GAUXC_HAS_MPI
+  std::unique_ptr<DistributedTaskQueue> task_queue;
+  if( ks_settings.inter_rank_work_stealing and 
+      this->load_balancer_->runtime().comm_size() > 1 )
+    task_queue = std::make_unique<DistributedTaskQueue>( task_begin, task_end,
+      this->load_balancer_->runtime().comm() );
+  std::vector<XCTask> stolen_tasks;
+  #endif
+
+  bool first_chunk = true;
+  auto next_chunk = [&]( const_task_iterator& begin, const_task_iterator& end ) {
+    #ifdef GAUXC_HAS_MPI
+    if( task_queue ) {
+      auto [first, last] = task_queue->next_local();
+      if( first != last ) {
+        begin = task_begin + first; end = task_begin + last;
+        return true;
+      }
+      stolen_tasks.clear();
+      if( task_queue->steal( stolen_tasks ) ) {
+        begin = stolen_tasks.begin(); end = stolen_tasks.end();
+        return true;
+      }
+      return false;
+    }
+    #endif
+    begin = task_begin; end = task_end;
+    return std::exchange( first_chunk, false );
+  };
+
+  const_task_iterator chunk_begin, chunk_end;
+  while( next_chunk( chunk_begin, chunk_end ) ) {
+
   // Loop over tasks
-  const size_t ntasks = std::distance(task_begin, task_end);
+  const size_t ntasks = std::distance(chunk_begin, chunk_end);
+
+  // Space filling curve orderings are walked in contiguous (spatially
+  // coherent) ranges per thread, dynamic scheduling otherwise
+  std::vector<size_t> task_cost( ntasks );
+  std::transform( chunk_begin, chunk_end, task_cost.begin(), 
+    []( const auto& t ){ return t.points.size() * t.bfn_screening.nbe; } );
+  TaskScheduler scheduler( task_cost, sfc_order );
 
   #pragma omp parallel
   {
 
   XCHostData<value_type> host_data; // Thread local host data
 
-  #pragma omp for schedule(dynamic)
-  for( size_t iT = 0; iT < ntasks; ++iT ) {
+  for( int64_t iT = scheduler.next(); iT >= 0; iT = scheduler.next() ) {
      
     //std::cout << iT << "/" << ntasks << std::endl;
     //if(is_exc_only) printf("%lu / %lu\n", iT, ntasks);
+
+    #ifdef GAUXC_HAS_MPI
+    // Serve steals of other ranks within (large) local chunks
+    if( task_queue ) task_queue->progress();
+    #endif
+
     // Alias current task
-    const auto& task = *(task_begin + iT);
+    const auto& task = *(chunk_begin + iT);
 
     // Get tasks constants
     const int32_t  npts    = task.points.size();
@@ -566,6 +652,8 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
   } // End OpenMP region
 
+  } // Loop over task chunks
+
 
   // Set scalar return values
   *EXC  = EXC_WORK;
@@ -45,8 +45,8 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   if( elec_ldvxcs < elec_nbf | prot_ldvxcs < prot_nbf | prot_ldvxcz < prot_nbf )
     GAUXC_GENERIC_EXCEPTION("Invalid LDVXC");
 
-  // Get Tasks
-  auto& tasks = this->load_balancer_->get_tasks();
+  // Get Tasks (reordered only if necessary)
+  const auto& tasks = get_ordered_tasks_( TaskOrdering::Size );
 
   // Temporary electron count to judge integrator accuracy
   value_type N_EL;
@@ -116,8 +116,8 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   if( elec_ldvxcs < elec_nbf | elec_ldvxcz < elec_nbf | prot_ldvxcs < prot_nbf | prot_ldvxcz < prot_nbf )
     GAUXC_GENERIC_EXCEPTION("Invalid LDVXC");
 
-  // Get Tasks
-  auto& tasks = this->load_balancer_->get_tasks();
+  // Get Tasks (reordered only if necessary)
+  const auto& tasks = get_ordered_tasks_( TaskOrdering::Size );
 
   // Temporary electron count to judge integrator accuracy
   value_type N_EL;
@@ -173,7 +173,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
                            value_type* elec_EXC,  value_type* prot_EXC,  
                            value_type *N_EL,      value_type *N_PROT,
                            const IntegratorSettingsXC& settings,
-                           task_iterator task_begin, task_iterator task_end) {
+                           const_task_iterator task_begin, const_task_iterator task_end) {
   
   // Determine is electronic subsystem is RKS or UKS
   const bool is_uks = (elec_Pz != nullptr) and (elec_VXCz != nullptr);
@@ -200,13 +200,8 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   BasisSetMap protonic_basis_map(protonic_basis,mol);
   const int32_t protonic_nbf = protonic_basis.nbf();
 
-  // Sort tasks on size (XXX: maybe doesnt matter?)
-  auto task_comparator = []( const XCTask& a, const XCTask& b ) {
-    return (a.points.size() * a.bfn_screening.nbe) > (b.points.size() * b.bfn_screening.nbe);
-  };
-  
-  auto& tasks = this->load_balancer_->get_tasks();
-  std::sort( task_begin, task_end, task_comparator );
+  // The tasks are ordered by the caller (see get_ordered_tasks_)
+  const auto& tasks = std::as_const(*this->load_balancer_).get_tasks();
 
 
   // Check that Partition Weights have been calculated
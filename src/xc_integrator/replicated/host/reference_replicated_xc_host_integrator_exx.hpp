@@ -11,10 +11,17 @@
 #include "integrator_util/integrator_common.hpp"
 #include "integrator_util/integral_bounds.hpp"
 #include "integrator_util/exx_screening.hpp"
+#include "integrator_util/distributed_task_queue.hpp"
+#include "task_grouping.hpp"
 #include "host/local_host_work_driver.hpp"
 #include "host/blas.hpp"
 #include <stdexcept>
 #include <set>
+#include <limits>
+#include <numeric>
+#include <chrono>
+#include <memory>
+#include <utility>
 
 #include <gauxc/util/geometry.hpp>
 
@@ -49,12 +56,15 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     GAUXC_GENERIC_EXCEPTION("Invalid LDVXC");
 
 
-  // Get Tasks
-  this->load_balancer_->get_tasks();
+  // Generate Tasks (non-const access would otherwise invalidate the cached
+  // EXX task view)
+  if( not this->load_balancer_->tasks_generated() ) 
+    this->load_balancer_->get_tasks();
 
-  // Compute Local contributions to EXC / VXC
+  // Compute Local contributions to K
   this->timer_.time_op("XCIntegrator.LocalWork", [&](){
-    exx_local_work_( P, ldp, K, ldk, settings );
+    coulomb_exx_local_work_( P, ldp, nullptr, 0, K, ldk, nullptr,
+      IntegratorSettingsCoulomb{}, settings );
   });
 
   #ifdef GAUXC_HAS_MPI
@@ -75,7 +85,52 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
 }
 
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  eval_exx_energy_( int64_t m, int64_t n, const value_type* P,
+                    int64_t ldp, value_type* EXX,
+                    const IntegratorSettingsEXX& settings ) {
+
+  const auto& basis = this->load_balancer_->basis();
+
+  // Check that P is sane
+  const int64_t nbf = basis.nbf();
+  if( m != n ) 
+    GAUXC_GENERIC_EXCEPTION("P Must Be Square");
+  if( m != nbf ) 
+    GAUXC_GENERIC_EXCEPTION("P Must Have Same Dimension as Basis");
+  if( ldp < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDP");
+
+
+  // Generate Tasks (non-const access would otherwise invalidate the cached
+  // EXX task view)
+  if( not this->load_balancer_->tasks_generated() ) 
+    this->load_balancer_->get_tasks();
+
+  // Compute Local contributions to EXX
+  this->timer_.time_op("XCIntegrator.LocalWork", [&](){
+    coulomb_exx_local_work_( P, ldp, nullptr, 0, nullptr, 0, EXX,
+      IntegratorSettingsCoulomb{}, settings );
+  });
+
+  #ifdef GAUXC_HAS_MPI
+  this->timer_.time_op("XCIntegrator.LocalWait", [&](){
+    MPI_Barrier( this->load_balancer_->runtime().comm() );
+  });
+  #endif
 
+  // Reduce Results
+  this->timer_.time_op("XCIntegrator.Allreduce", [&](){
+
+    if( not this->reduction_driver_->takes_host_memory() )
+      GAUXC_GENERIC_EXCEPTION("This Module Only Works With Host Reductions");
+
+    this->reduction_driver_->allreduce_inplace( EXX, 1, ReductionOp::Sum );
+
+  });
+
+}
 
 
 
@@ -265,10 +320,117 @@ auto compute_sn_LinK_ek_set( size_t nshells, const std::vector<int32_t>& shell_l
 
 
 
+template <typename ValueType>
+const std::vector<XCTask>& ReferenceReplicatedXCHostIntegrator<ValueType>::
+  get_exx_task_view_( const value_type* P, int64_t ldp, 
+    const BasisSetMap& basis_map, const double* V_max, double eps_E, 
+    double eps_K ) {
+
+  auto* lwd = dynamic_cast<LocalHostWorkDriver*>(this->local_work_driver_.get());
+
+  const auto& basis    = this->load_balancer_->basis();
+  const auto& shpairs  = this->load_balancer_->shell_pairs();
+  const auto& lb_tasks = std::as_const(*this->load_balancer_).get_tasks();
+  const int32_t nbf    = basis.nbf();
+  const size_t nshells_bf = basis.size();
+
+  auto& view = exx_view_;
+  const auto generation = this->load_balancer_->generation();
+
+  // A rank may hold no local tasks
+  if( lb_tasks.empty() ) {
+    view = exx_task_view();
+    view.generation = generation;
+    return view.tasks;
+  }
+
+  const size_t npts_src = std::accumulate( lb_tasks.begin(), lb_tasks.end(), 
+    0ul, [](const auto& a, const auto& t){ return a + t.points.size(); } );
+
+  // The merged tasks are current if the load balancer tasks are unchanged:
+  // their generation changes with every (possible) modification of the 
+  // tasks, e.g. geometry / basis / weight updates or reordering
+  const bool tasks_current = view.generation == generation and 
+    view.ntasks_src == lb_tasks.size() and view.npts_src == npts_src;
+
+  if( not tasks_current ) {
+
+    view.ntasks_src = lb_tasks.size();
+    view.npts_src   = npts_src;
+    view.generation = generation;
+    view.P.clear(); // Rescreen
+
+    // Merge tasks with equivalent basis screening, allowing for different 
+    // iParent (retaining the load balancer task indices)
+    std::vector<XCTask> tasks( lb_tasks.begin(), lb_tasks.end() );
+    for(auto& task : tasks) task.iParent = 0;
+
+    view.src = group_equivalent_tasks( tasks.begin(), tasks.end(), 
+      []( const auto& t ) { return t.fingerprint(); },
+      []( const auto& a, const auto& b ) { return a.equiv_with(b); } );
+    view.tasks.resize( view.src.size() );
+    #pragma omp parallel for schedule(dynamic)
+    for( size_t i = 0; i < view.src.size(); ++i )
+      view.tasks[i] = merge_task_group( tasks, view.src[i] );
+
+  }
+
+  // The ek screening is current if P and the tolerances are unchanged
+  bool screening_current = view.eps_E == eps_E and view.eps_K == eps_K and
+    view.P.size() == size_t(nbf*nbf);
+  for( int32_t j = 0; j < nbf and screening_current; ++j )
+    screening_current = std::equal( P + j*ldp, P + j*ldp + nbf, 
+      view.P.data() + j*nbf );
+  if( screening_current ) return view.tasks;
+
+  view.P.resize( nbf*nbf );
+  for( int32_t j = 0; j < nbf; ++j )
+    std::copy( P + j*ldp, P + j*ldp + nbf, view.P.data() + j*nbf );
+  view.eps_E = eps_E;
+  view.eps_K = eps_K;
+
+  // Absolute value of P
+  std::vector<double> P_abs(nbf*nbf);
+  for( auto i = 0; i < nbf*nbf; ++i ) P_abs[i] = std::abs(view.P[i]);
+
+  // Redo the EK shell screening of the merged tasks
+  for(auto& task : view.tasks) task.cou_screening = XCTask::screening_data();
+  exx_ek_screening( basis, basis_map, shpairs, P_abs.data(), nbf, V_max, 
+    nshells_bf, eps_E, eps_K, lwd, view.tasks.begin(), view.tasks.end() );
+
+  // Order on decreasing number of shell pairs
+  const size_t ntasks = view.tasks.size();
+  std::vector<size_t> order( ntasks );
+  std::iota( order.begin(), order.end(), 0 );
+  std::stable_sort( order.begin(), order.end(), [&]( auto a, auto b ) {
+    return view.tasks[a].cou_screening.shell_pair_list.size() >
+           view.tasks[b].cou_screening.shell_pair_list.size();
+  });
+
+  std::vector<XCTask> tasks_ordered; tasks_ordered.reserve( ntasks );
+  std::vector<std::vector<size_t>> src_ordered; src_ordered.reserve( ntasks );
+  for( auto idx : order ) {
+    tasks_ordered.emplace_back( std::move(view.tasks[idx]) );
+    src_ordered.emplace_back( std::move(view.src[idx]) );
+  }
+  view.tasks = std::move(tasks_ordered);
+  view.src   = std::move(src_ordered);
+
+  return view.tasks;
+
+}
+
 template <typename ValueType>
 void ReferenceReplicatedXCHostIntegrator<ValueType>::
-  exx_local_work_( const value_type* P, int64_t ldp, 
-    value_type* K, int64_t ldk, const IntegratorSettingsEXX& settings ) {
+  coulomb_exx_local_work_( const value_type* P, int64_t ldp, 
+    value_type* J, int64_t ldj, value_type* K, int64_t ldk, value_type* EXX,
+    const IntegratorSettingsCoulomb& cou_settings,
+    const IntegratorSettingsEXX& settings ) {
+
+  const bool do_j = J   != nullptr;
+  const bool do_k = K   != nullptr;
+  const bool do_e = EXX != nullptr;
+  const bool do_x = do_k or do_e; // sn-LinK G matrix required
 
   // Cast LWD to LocalHostWorkDriver
   auto* lwd = dynamic_cast<LocalHostWorkDriver*>(this->local_work_driver_.get());
@@ -284,13 +446,9 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
   const int32_t nbf = basis.nbf();
 
-  // Sort tasks on size (XXX: maybe doesnt matter?)
-  auto task_comparator = []( const XCTask& a, const XCTask& b ) {
-    return (a.points.size() * a.bfn_screening.nbe) > (b.points.size() * b.bfn_screening.nbe);
-  };
-
-  auto& tasks = this->load_balancer_->get_tasks();
-  std::sort( tasks.begin(), tasks.end(), task_comparator );
+  // The load balancer tasks are never reordered or modified here, sn-LinK
+  // operates on its own (cached) task view
+  const auto& lb_tasks = std::as_const(*this->load_balancer_).get_tasks();
 
 
   // Check that Partition Weights have been calculated
@@ -300,10 +458,18 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   }
 
   // Zero out integrands
+  if( do_j )
+  for( auto j = 0; j < nbf; ++j )
+  for( auto i = 0; i < nbf; ++i ) 
+    J[i + j*ldj] = 0.;
+
+  if( do_k )
   for( auto j = 0; j < nbf; ++j )
   for( auto i = 0; i < nbf; ++i ) 
     K[i + j*ldk] = 0.;
 
+  if( do_e ) *EXX = 0.;
+
    
   // Compute V upper bounds per shell pair
   const size_t nshells_bf = basis.size();
@@ -322,10 +488,6 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     }
   }
 
-  // Absolute value of P
-  std::vector<double> P_abs(nbf*nbf);
-  for( auto i = 0; i < nbf*nbf; ++i ) P_abs[i] = std::abs(P[i]);
-
   // Full shell list
   std::vector<int32_t> full_shell_list_( basis.nshells() );
   std::iota( full_shell_list_.begin(), full_shell_list_.end(), 0 );
@@ -338,8 +500,61 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   }
 
   const bool screen_ek = sn_link_settings.screen_ek;
-  const double eps_K   = sn_link_settings.k_tol;
+  // The K criterion is irrelevant if only the energy is requested
+  const double eps_K   = do_k ? sn_link_settings.k_tol :
+                                std::numeric_limits<double>::infinity();
   const double eps_E   = sn_link_settings.energy_tol;
+  const double eps_MP  = sn_link_settings.multipole_tol;
+  const auto   engine  = sn_link_settings.integral_engine;
+  const double omega   = sn_link_settings.omega;
+  const double alpha   = sn_link_settings.alpha;
+  const double beta    = sn_link_settings.beta;
+
+  // |(alpha + beta * erf(omega*r)) / r| <= (|alpha| + |beta|) / r, fold the
+  // operator scale into the ek screening tolerances
+  const bool   attenuated = omega > 0. and beta != 0.;
+  const double op_scale   = std::abs(alpha) + (attenuated ? std::abs(beta) : 0.);
+  const double eps_E_op   = op_scale > 0. ? eps_E / op_scale : 
+                                            std::numeric_limits<double>::infinity();
+  const double eps_K_op   = op_scale > 0. ? eps_K / op_scale :
+                                            std::numeric_limits<double>::infinity();
+
+  IntegratorSettingsSNJ sn_j_settings;
+  if( auto* tmp = dynamic_cast<const IntegratorSettingsSNJ*>(&cou_settings) ) {
+    sn_j_settings = *tmp;
+  }
+
+  const double eps_J    = sn_j_settings.j_tol;
+  const double eps_MP_J = sn_j_settings.multipole_tol;
+
+  // Per-class integral engines are selected outside of the parallel region
+  // and agreed on across ranks
+  if( do_x and engine == ShellPairIntegralEngine::Auto and not attenuated )
+    lwd->setup_shell_pair_engines( this->load_balancer_->runtime() );
+
+  // Generate far-field multipole data for the shell pairs
+  if( (do_x and eps_MP > 0.) or (do_j and eps_MP_J > 0.) ) 
+    this->load_balancer_->shell_pairs_with_multipoles();
+
+  // sn-J shell pairs (i >= j) sorted on decreasing V bounds such that
+  // the per-task screening may stop at the first negligible pair
+  std::vector<std::pair<int32_t,int32_t>> j_shell_pairs;
+  std::vector<double> j_shell_pair_V;
+  if( do_j ) {
+    std::vector<std::pair<double,std::pair<int32_t,int32_t>>> tmp;
+    tmp.reserve( shpairs.npairs() );
+    for( auto i = 0; i < nshells_bf; ++i )
+    for( auto _j = sp_row_ptr[i]; _j < sp_row_ptr[i+1]; ++_j ) {
+      const int32_t j = sp_col_ind[_j];
+      tmp.push_back( { V_max[i + j*nshells_bf], {i, j} } );
+    }
+    std::sort( tmp.begin(), tmp.end(), 
+      [](const auto& a, const auto& b){ return a.first > b.first; } );
+    for( const auto& [v, ij] : tmp ) {
+      j_shell_pair_V.push_back(v);
+      j_shell_pairs.push_back(ij);
+    }
+  }
 
   int world_rank = 0;
   #ifdef GAUXC_HAS_MPI
@@ -354,106 +569,141 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   //            << std::endl;
   //}
 
-  // Reset the coulomb screening data
-  for(auto& task : tasks) task.cou_screening = XCTask::screening_data();
-
-  // Precompute EK shell screening
-  exx_ek_screening( basis, basis_map, shpairs, P_abs.data(), nbf, V_max.data(), 
-    nshells_bf, eps_E, eps_K, lwd, tasks.begin(), tasks.end() );
-
-  // Allow for merging of tasks with different iParent
-  for(auto& task : tasks) task.iParent = 0;
-
-#if 1
-  // Lexicographic ordering of tasks
-  auto task_order = []( const auto& a, const auto& b ) {
-
-    // Sort by iParent first
-    if( a.iParent < b.iParent )      return true;
-    else if( a.iParent > b.iParent ) return false;
-
-    // Equal iParent: lex sort on bfn shell list
-    else if(a.bfn_screening.shell_list < b.bfn_screening.shell_list) return true;
-    else if(a.bfn_screening.shell_list > b.bfn_screening.shell_list) return false;
-    
-    // Equal iParent and bfn shell list: lex sort on cou shell list
-    else return a.cou_screening.shell_list < b.cou_screening.shell_list;
-
-  };
-
-  std::sort( tasks.begin(), tasks.end(), task_order ); 
-  auto task_equiv = []( const auto& a, const auto& b ) {
-    return a.equiv_with(b) and 
-      a.cou_screening.equiv_with(b.cou_screening);
-  };
-  std::vector<XCTask> local_work_unique(tasks.begin(), tasks.end());
-  auto last_unique =
-    std::unique( local_work_unique.begin(),
-                 local_work_unique.end(),
-                 task_equiv );
-  local_work_unique.erase( last_unique, local_work_unique.end() );
-
-  // Merge tasks
-  for( auto&& t : local_work_unique ) {
-    t.points.clear();
-    t.weights.clear();
-    t.npts = 0;
+  // Task view: merged and ek screened tasks for sn-LinK, otherwise the
+  // load balancer tasks ordered on decreasing cost
+  std::vector<const XCTask*> tasks;
+  if( do_x ) {
+    const auto& exx_tasks = get_exx_task_view_( P, ldp, basis_map, 
+      V_max.data(), eps_E_op, eps_K_op );
+    tasks.reserve( exx_tasks.size() );
+    for( const auto& task : exx_tasks ) tasks.push_back( &task );
+  } else {
+    tasks.reserve( lb_tasks.size() );
+    for( const auto& task : lb_tasks ) tasks.push_back( &task );
+    std::sort( tasks.begin(), tasks.end(), []( auto* a, auto* b ) {
+      return (a->points.size() * a->bfn_screening.nbe) > 
+             (b->points.size() * b->bfn_screening.nbe);
+    });
   }
 
-  auto cur_lw_begin = tasks.begin();
-  auto cur_uniq_it  = local_work_unique.begin();
 
-  for( auto lw_it = tasks.begin(); lw_it != tasks.end(); ++lw_it ) 
-  if( not task_equiv( *lw_it, *cur_uniq_it ) ) {
-
-    if( cur_uniq_it == local_work_unique.end() )
-      GAUXC_GENERIC_EXCEPTION("Messed up in unique");
-
-    cur_uniq_it->merge_with( cur_lw_begin, lw_it );
-
-    cur_lw_begin = lw_it;
-    cur_uniq_it++;
+  // Loop over tasks
+  const size_t ntasks = tasks.size();
+  //std::cout << "NTASKS = " << ntasks << std::endl;
+  //std::cout << "NTASKS NNZ = " << std::count_if(tasks.begin(),tasks.end(),[](const auto& t){ return t.cou_screening.shell_pair_list.size(); }) << std::endl;
+  // Thread local K accumulators, reduced and symmetrized after the task loop
+  std::vector<double*> K_thread;
+
+  // Measured wall time of the sn-LinK tasks (excluding the sn-J work)
+  using hrt_t = std::chrono::high_resolution_clock;
+  using dur_t = std::chrono::duration<double>;
+  std::vector<double> task_time( do_x ? ntasks : 0, 0. );
+
+  // Chunks of tasks to process: all tasks, or with inter-rank work stealing
+  // of the sn-LinK tasks, chunks of the local tasks followed by tasks stolen
+  // from other ranks. J / K / EXX of stolen tasks are accumulated locally
+  // (and reduced), their measured costs are returned to the owner
+  const XCTask* const* chunk_tasks = nullptr;
+  double* chunk_time = nullptr;
+  size_t  chunk_size = 0;
+  bool    has_chunk  = false;
 
+  #ifdef GAUXC_HAS_MPI
+  const auto& runtime = this->load_balancer_->runtime();
+  std::unique_ptr<DistributedTaskQueue> task_queue;
+  MPI_Win task_time_win;
+  if( do_x and sn_link_settings.inter_rank_work_stealing and 
+      runtime.comm_size() > 1 ) {
+    task_queue = std::make_unique<DistributedTaskQueue>( 
+      exx_view_.tasks.begin(), exx_view_.tasks.end(), runtime.comm() );
+    MPI_Win_create( task_time.data(), ntasks * sizeof(double), sizeof(double),
+      MPI_INFO_NULL, runtime.comm(), &task_time_win );
+    MPI_Win_lock_all( MPI_MODE_NOCHECK, task_time_win );
   }
+  std::vector<XCTask>        stolen_tasks;
+  std::vector<const XCTask*> stolen_task_ptrs;
+  std::vector<double>        stolen_time;
+  DistributedTaskQueue::stolen_range stolen;
+  bool chunk_stolen = false;
+  #endif
 
-  // Merge the last set of batches
-  for( ; cur_lw_begin != tasks.end(); ++cur_lw_begin )
-    cur_uniq_it->merge_with( *cur_lw_begin );
-  cur_uniq_it++;
-
-  tasks = std::move(local_work_unique);
-#endif
-
-  std::sort(tasks.begin(),tasks.end(),
-    [](auto& a, auto& b){ return a.cou_screening.shell_pair_list.size() >
-      b.cou_screening.shell_pair_list.size(); });
+  bool first_chunk = true;
+  auto next_chunk = [&]() {
+    #ifdef GAUXC_HAS_MPI
+    if( task_queue ) {
+      auto [first, last] = task_queue->next_local();
+      chunk_stolen = first == last;
+      if( not chunk_stolen ) {
+        chunk_tasks = tasks.data() + first; chunk_time = task_time.data() + first;
+        chunk_size  = last - first;
+        return true;
+      }
+      stolen_tasks.clear();
+      if( not task_queue->steal( stolen_tasks, &stolen ) ) return false;
+      stolen_task_ptrs.clear();
+      for( const auto& task : stolen_tasks ) stolen_task_ptrs.push_back( &task );
+      stolen_time.assign( stolen_tasks.size(), 0. );
+      chunk_tasks = stolen_task_ptrs.data(); chunk_time = stolen_time.data();
+      chunk_size  = stolen_tasks.size();
+      return true;
+    }
+    #endif
+    chunk_tasks = tasks.data(); chunk_time = task_time.data();
+    chunk_size  = ntasks;
+    return std::exchange( first_chunk, false );
+  };
 
+  // Return the measured costs of stolen tasks to their owner
+  auto finish_chunk = [&]() {
+    #ifdef GAUXC_HAS_MPI
+    if( task_queue and chunk_stolen and chunk_size ) {
+      MPI_Put( stolen_time.data(), chunk_size, MPI_DOUBLE, stolen.rank, 
+        stolen.first, chunk_size, MPI_DOUBLE, task_time_win );
+      MPI_Win_flush( stolen.rank, task_time_win );
+    }
+    #endif
+  };
 
-  // Loop over tasks
-  const size_t ntasks = tasks.size();
-  //std::cout << "NTASKS = " << ntasks << std::endl;
-  //std::cout << "NTASKS NNZ = " << std::count_if(tasks.begin(),tasks.end(),[](const auto& t){ return t.cou_screening.shell_pair_list.size(); }) << std::endl;
   #pragma omp parallel
   {
 
   XCHostData<value_type> host_data; // Thread local host data
-  std::vector<double> K_local(nbf*nbf,0.0);
+  std::vector<double> J_local(do_j ? nbf*nbf : 0, 0.0);
+  std::vector<double> K_local(do_k ? nbf*nbf : 0, 0.0);
+  if( do_k ) {
+    #pragma omp critical
+    K_thread.push_back( K_local.data() );
+  }
+  std::vector<std::pair<int32_t,int32_t>> j_shell_pair_list;
+  double EXX_local = 0.;
+
+  // The queue is only accessed from the main thread
+  while( true ) {
+
+  #pragma omp master
+  has_chunk = next_chunk();
+  #pragma omp barrier
+  if( not has_chunk ) break;
 
   #pragma omp for schedule(dynamic)
-  for( size_t iT = 0; iT < ntasks; ++iT ) {
+  for( size_t iT = 0; iT < chunk_size; ++iT ) {
+
+    #ifdef GAUXC_HAS_MPI
+    // Serve steals of other ranks within (large) local chunks
+    if( task_queue ) task_queue->progress();
+    #endif
 
     //std::cout << iT << "/" << ntasks << std::endl;
     // Alias current task
-    const auto& task = tasks[iT];
+    const auto& task = *chunk_tasks[iT];
+    const auto task_st = hrt_t::now();
 
     // Early exit
     auto ek_shell_list = task.cou_screening.shell_list;
-    if( ek_shell_list.size() == 0 ) {
+    const bool task_do_x = do_x and ek_shell_list.size();
+    if( not task_do_x and not do_j ) {
       continue;
     }
-    std::vector< std::array<int32_t,3> > ek_submat_map;
-    std::tie( ek_submat_map, std::ignore ) =
-      gen_compressed_submat_map( basis_map, ek_shell_list, nbf, nbf );
 
     // Get tasks constants
     const int32_t  npts    = task.points.size();
@@ -487,6 +737,46 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     lwd->eval_collocation( npts, nshells_bfn, nbe_bfn, points, basis, 
       shell_list_bfn, basis_eval );
 
+    double j_time = 0.;
+    if( do_j ) {
+      const auto j_st = hrt_t::now();
+
+      host_data.zmat   .resize( npts * nbe_bfn );
+      host_data.den_scr.resize( npts );
+      auto* xmat     = host_data.zmat.data();
+      auto* den_eval = host_data.den_scr.data();
+
+      // Evaluate X(mu,i) = P(mu,nu) * B(nu,i) and rho(i) = B(mu,i) * X(mu,i)
+      lwd->eval_xmat( npts, nbf, nbe_bfn, submat_map_bfn, 1.0, P, ldp, 
+        basis_eval, nbe_bfn, xmat, nbe_bfn, nbe_scr );
+      lwd->eval_uvvar_lda_rks( npts, nbe_bfn, basis_eval, xmat, nbe_bfn, 
+        den_eval );
+
+      // Screen shell pairs on |J(mu,nu)| <= V(mu,nu) * sum_i w(i) |rho(i)|
+      double den_sum = 0.;
+      for( auto i = 0; i < npts; ++i ) 
+        den_sum += weights[i] * std::abs(den_eval[i]);
+
+      j_shell_pair_list.clear();
+      for( size_t ij = 0; ij < j_shell_pairs.size(); ++ij ) {
+        if( j_shell_pair_V[ij] * den_sum < eps_J ) break;
+        j_shell_pair_list.push_back( j_shell_pairs[ij] );
+      }
+
+      // Increment J(mu,nu) += w(i) * rho(i) * A(mu,nu,i)
+      lwd->inc_coulomb_j( npts, j_shell_pair_list.size(), points, weights,
+        den_eval, basis, shpairs, basis_map, j_shell_pair_list.data(), 
+        J_local.data(), nbf, eps_MP_J );
+
+      j_time = dur_t( hrt_t::now() - j_st ).count();
+    }
+
+    if( not task_do_x ) continue;
+
+    std::vector< std::array<int32_t,3> > ek_submat_map;
+    std::tie( ek_submat_map, std::ignore ) =
+      gen_compressed_submat_map( basis_map, ek_shell_list, nbf, nbf );
+
     const auto nbe_ek = basis.nbf_subset( ek_shell_list.begin(), ek_shell_list.end() );
     const auto nshells_ek = ek_shell_list.size();
 
@@ -516,28 +806,86 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     const auto*  shell_pair_list = task.cou_screening.shell_pair_list.data();
     lwd->eval_exx_gmat( npts, nshells_ek, nshell_pairs, nbe_ek, points, weights, 
       basis, shpairs,basis_map, ek_shell_list.data(), shell_pair_list, zmat, 
-      nbe_ek, gmat, nbe_ek );
+      nbe_ek, gmat, nbe_ek, eps_MP, engine, alpha, beta, omega );
 
     // Increment K(mu,nu) += B(mu,i) * G(nu,i)
     // mu runs over bfn shell list
     // nu runs over ek shells
     // i runs over all points
+    if( do_k )
     lwd->inc_exx_k( npts, nbf, nbe_bfn, nbe_ek, basis_eval, submat_map_bfn,
-      ek_submat_map, gmat, nbe_ek, K, ldk, nbe_scr );
+      ek_submat_map, gmat, nbe_ek, K_local.data(), nbf, nbe_scr );
+
+    // Increment EXX += tr(P K) = F(mu,i) * G(mu,i)
+    if( do_e )
+      EXX_local += blas::dot( npts*nbe_ek, zmat, 1, gmat, 1 );
+
+    if( do_x ) 
+      chunk_time[iT] = dur_t( hrt_t::now() - task_st ).count() - j_time;
 
   } // Loop over tasks 
 
+  #pragma omp master
+  finish_chunk();
+
+  } // Loop over chunks
+
+  // Reduce thread local J
+  if( do_j ) {
+    #pragma omp critical
+    for( auto j = 0; j < nbf; ++j )
+    for( auto i = 0; i < nbf; ++i )
+      J[i + j*ldj] += J_local[i + j*nbf];
+  }
+
+  // Reduce thread local EXX
+  if( do_e ) {
+    #pragma omp atomic
+    *EXX += EXX_local;
+  }
+
+  // Reduce and symmetrize thread local K, only visiting the unique
+  // triangle: K(i,j) = K(j,i) = 0.5 * sum_t (K_t(i,j) + K_t(j,i))
+  if( do_k ) {
+    #pragma omp barrier
+
+    #pragma omp for schedule(dynamic)
+    for( int32_t j = 0; j < nbf; ++j ) 
+    for( int32_t i = 0; i <= j;  ++i ) {
+      double K_symm = K[i + j*ldk] + K[j + i*ldk];
+      for( auto* K_t : K_thread ) K_symm += K_t[i + j*nbf] + K_t[j + i*nbf];
+      K_symm *= 0.5;
+      K[i + j*ldk] = K_symm;
+      K[j + i*ldk] = K_symm;
+    }
+  }
 
   } // End OpenMP region
 
-  // Symmetrize K
-  for( auto j = 0; j < nbf; ++j ) 
-  for( auto i = 0; i < j;   ++i ) {
-    const auto K_ij = K[i + j*ldk];
-    const auto K_ji = K[j + i*ldk];
-    const auto K_symm = 0.5 * (K_ij + K_ji);
-    K[i + j*ldk] = K_symm;
-    K[j + i*ldk] = K_symm;
+  #ifdef GAUXC_HAS_MPI
+  // The costs of all stolen tasks have arrived once the window is freed
+  if( task_queue ) {
+    MPI_Win_unlock_all( task_time_win );
+    MPI_Win_free( &task_time_win );
+  }
+  #endif
+
+  // Attribute the measured costs to the load balancer tasks (by number of
+  // points for merged tasks) for use in LoadBalancer::rebalance_exx
+  if( do_x ) {
+    auto& lb_tasks_cost = this->load_balancer_->get_tasks();
+    for( auto& task : lb_tasks_cost ) task.cost_exx_measured = 0.;
+    for( size_t iT = 0; iT < ntasks; ++iT ) {
+      const auto npts = tasks[iT]->points.size();
+      if( !npts ) continue;
+      const auto time_per_pt = task_time[iT] / npts;
+      for( auto i : exx_view_.src[iT] ) lb_tasks_cost[i].cost_exx_measured = 
+        time_per_pt * lb_tasks_cost[i].points.size();
+    }
+    lb_state.exx_costs_measured = true;
+
+    // Cost attribution leaves the tasks (and thus the task view) unchanged
+    exx_view_.generation = this->load_balancer_->generation();
   }
 
 }
@@ -31,8 +31,9 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     GAUXC_GENERIC_EXCEPTION("Invalid LDP");
 
 
-  // Get Tasks
-  this->load_balancer_->get_tasks();
+  // Generate Tasks
+  if( not this->load_balancer_->tasks_generated() ) 
+    this->load_balancer_->get_tasks();
 
   *N_EL = 0.;
   // Compute Local contributions to EXC / VXC
@@ -71,12 +72,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   const int32_t nbf = basis.nbf();
 
   // Sort tasks on size (XXX: maybe doesnt matter?)
-  auto task_comparator = []( const XCTask& a, const XCTask& b ) {
-    return (a.points.size() * a.bfn_screening.nbe) > (b.points.size() * b.bfn_screening.nbe);
-  };
-
-  auto& tasks = this->load_balancer_->get_tasks();
-  std::sort( tasks.begin(), tasks.end(), task_comparator );
+  const auto& tasks = get_ordered_tasks_( TaskOrdering::Size );
 
 
   // Compute Partition Weights
@@ -181,9 +181,10 @@ void ReplicatedXCIntegratorImpl<ValueType>::
 template <typename ValueType>
 void ReplicatedXCIntegratorImpl<ValueType>::
   eval_exc_grad( int64_t m, int64_t n, const value_type* P,
-                int64_t ldp, value_type* EXC_GRAD ) {
+                int64_t ldp, value_type* EXC_GRAD, 
+                const IntegratorSettingsXC& ks_settings ) {
 
-    eval_exc_grad_(m,n,P,ldp,EXC_GRAD);
+    eval_exc_grad_(m,n,P,ldp,EXC_GRAD,ks_settings);
 
 }
 
@@ -197,6 +198,38 @@ void ReplicatedXCIntegratorImpl<ValueType>::
 
 }
 
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_exx_energy( int64_t m, int64_t n, const value_type* P,
+                   int64_t ldp, value_type* EXX,
+                   const IntegratorSettingsEXX& settings ) {
+
+    eval_exx_energy_(m,n,P,ldp,EXX,settings);
+
+}
+
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_coulomb( int64_t m, int64_t n, const value_type* P,
+                int64_t ldp, value_type* J, int64_t ldj,
+                const IntegratorSettingsCoulomb& settings ) {
+
+    eval_coulomb_(m,n,P,ldp,J,ldj,settings);
+
+}
+
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_coulomb_exx( int64_t m, int64_t n, const value_type* P,
+                    int64_t ldp, value_type* J, int64_t ldj,
+                    value_type* K, int64_t ldk,
+                    const IntegratorSettingsCoulomb& cou_settings,
+                    const IntegratorSettingsEXX& exx_settings ) {
+
+    eval_coulomb_exx_(m,n,P,ldp,J,ldj,K,ldk,cou_settings,exx_settings);
+
+}
+
 template class ReplicatedXCIntegratorImpl<double>;
 
 }
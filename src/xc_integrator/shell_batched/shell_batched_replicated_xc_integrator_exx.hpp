@@ -22,5 +22,34 @@ void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType
   util::unused(m,n,P,ldp,K,ldk,settings);
 }
 
+template <typename BaseIntegratorType, typename IncoreIntegratorType>
+void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType>::
+  eval_exx_energy_( int64_t m, int64_t n, const value_type* P,
+                    int64_t ldp, value_type* EXX, 
+                    const IntegratorSettingsEXX& settings ) { 
+  GAUXC_GENERIC_EXCEPTION("ShellBatched exx energy NYI");                 
+  util::unused(m,n,P,ldp,EXX,settings);
+}
+
+template <typename BaseIntegratorType, typename IncoreIntegratorType>
+void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType>::
+  eval_coulomb_( int64_t m, int64_t n, const value_type* P,
+                 int64_t ldp, value_type* J, int64_t ldj, 
+                 const IntegratorSettingsCoulomb& settings ) { 
+  GAUXC_GENERIC_EXCEPTION("ShellBatched sn-J NYI");                 
+  util::unused(m,n,P,ldp,J,ldj,settings);
+}
+
+template <typename BaseIntegratorType, typename IncoreIntegratorType>
+void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType>::
+  eval_coulomb_exx_( int64_t m, int64_t n, const value_type* P,
+                     int64_t ldp, value_type* J, int64_t ldj, 
+                     value_type* K, int64_t ldk, 
+                     const IntegratorSettingsCoulomb& cou_settings,
+                     const IntegratorSettingsEXX& exx_settings ) { 
+  GAUXC_GENERIC_EXCEPTION("ShellBatched sn-J NYI");                 
+  util::unused(m,n,P,ldp,J,ldj,K,ldk,cou_settings,exx_settings);
+}
+
 }
 }
@@ -7,7 +7,16 @@
  */
 #include "ut_common.hpp"
 #include <gauxc/load_balancer.hpp>
+#include <gauxc/molecular_weights.hpp>
 #include <gauxc/molgrid/defaults.hpp>
+#include <gauxc/external/hdf5.hpp>
+#include "xc_task_arena.hpp"
+#include "host/shell_spatial_index.hpp"
+#include <gauxc/util/geometry.hpp>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <utility>
 
 using namespace GauXC;
 
@@ -117,6 +126,16 @@ TEST_CASE( "DefaultLoadBalancer", "[load_balancer]" ) {
 
   }
 
+  SECTION("Distributed Host") {
+
+    // Distributed generation must reproduce the replicated tasks
+    LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Distributed" );
+    auto lb = lb_factory.get_instance( world, mol, mg, basis);
+    auto& tasks = lb.get_tasks();
+    check_lb_data( tasks );
+
+  }
+
 #ifdef GAUXC_HAS_DEVICE
   SECTION("Default Device") {
 
@@ -156,3 +175,595 @@ TEST_CASE( "DefaultLoadBalancer", "[load_balancer]" ) {
 
 
 }
+
+TEST_CASE( "HDF5-LoadBalancer", "[load_balancer]" ) {
+
+  auto world = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  Molecule mol           = make_water();
+  BasisSet<double> basis = make_631Gd( mol, SphericalType(false) );
+
+  for( auto& sh : basis ) 
+    sh.set_shell_tolerance( std::numeric_limits<double>::epsilon() );
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb = lb_factory.get_instance( world, mol, mg, basis );
+  const auto& tasks = lb.get_tasks();
+  lb.state().modified_weights_are_stored = true;
+
+  // Write file (one per rank)
+  std::string fname = GAUXC_REF_DATA_PATH "/test_lb.hdf5";
+  if( world.comm_size() > 1 ) fname += "." + std::to_string(world.comm_rank());
+  std::remove(fname.c_str());
+
+  write_hdf5_record( lb, GAUXC_REF_DATA_PATH "/test_lb.hdf5", "/LB" );
+
+  // Read into a fresh instance
+  auto lb_read = lb_factory.get_instance( world, mol, mg, basis );
+  read_hdf5_record( lb_read, GAUXC_REF_DATA_PATH "/test_lb.hdf5", "/LB" );
+
+  CHECK( lb_read.state().modified_weights_are_stored );
+  CHECK( not lb_read.state().exx_costs_measured );
+
+  const auto& tasks_read = lb_read.get_tasks();
+  REQUIRE( tasks_read.size() == tasks.size() );
+  for( size_t i = 0; i < tasks.size(); ++i ) {
+    const auto& t  = tasks[i];
+    const auto& rt = tasks_read[i];
+    CHECK( rt.iParent == t.iParent );
+    CHECK( rt.npts    == t.npts );
+    CHECK( rt.dist_nearest == t.dist_nearest );
+    CHECK( rt.points  == t.points );
+    CHECK( rt.weights == t.weights );
+    CHECK( rt.bfn_screening.shell_list == t.bfn_screening.shell_list );
+    CHECK( rt.bfn_screening.nbe == t.bfn_screening.nbe );
+  }
+
+  std::remove(fname.c_str());
+
+}
+
+TEST_CASE( "LoadBalancer Geometry Update", "[load_balancer]" ) {
+
+  auto world = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  Molecule mol = make_water();
+  Molecule mol_new = mol;
+  mol_new[0].y += 0.03; mol_new[0].z -= 0.02;
+  mol_new[2].x += 0.01; mol_new[2].y += 0.04;
+
+  auto make_basis = []( const Molecule& m ) {
+    auto basis = make_631Gd( m, SphericalType(false) );
+    for( auto& sh : basis ) 
+      sh.set_shell_tolerance( std::numeric_limits<double>::epsilon() );
+    return basis;
+  };
+  auto basis     = make_basis( mol );
+  auto basis_new = make_basis( mol_new );
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb = lb_factory.get_instance( world, mol, mg, basis );
+  // Partitioned weights are replaced by the quadrature weights
+  MolecularWeightsFactory( ExecutionSpace::Host, "Default", 
+    MolecularWeightsSettings{} ).get_instance().modify_weights( lb );
+  CHECK( lb.state().modified_weights_are_stored );
+
+  lb.update_geometry( mol_new );
+  auto lb_ref = lb_factory.get_instance( world, mol_new, mg, basis_new );
+
+  CHECK( not lb.state().modified_weights_are_stored );
+  CHECK( mol_new == lb.molecule() );
+  CHECK( lb.basis() == basis_new );
+
+  // Same quadrature as a LoadBalancer generated for the new geometry
+  auto gather_points = []( const std::vector<XCTask>& tasks ) {
+    std::vector<std::array<double,4>> pts;
+    for( const auto& t : tasks ) {
+      CHECK( t.bfn_screening.nbe > 0 );
+      for( size_t i = 0; i < t.points.size(); ++i )
+        pts.push_back({ t.points[i][0], t.points[i][1], t.points[i][2], 
+          t.weights[i] });
+    }
+    std::sort( pts.begin(), pts.end() );
+    return pts;
+  };
+
+  auto pts     = gather_points( lb.get_tasks() );
+  auto pts_ref = gather_points( lb_ref.get_tasks() );
+
+  // Points are translated with their atoms, equal up to round off
+  if( world.comm_size() == 1 ) {
+    REQUIRE( pts.size() == pts_ref.size() );
+    for( size_t i = 0; i < pts.size(); ++i )
+    for( int k = 0; k < 4; ++k )
+      CHECK( pts[i][k] == Approx(pts_ref[i][k]).margin(1e-12) );
+  }
+
+#ifdef GAUXC_HAS_MPI
+  size_t npts = pts.size(), npts_ref = pts_ref.size();
+  MPI_Allreduce( MPI_IN_PLACE, &npts,     1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD );
+  MPI_Allreduce( MPI_IN_PLACE, &npts_ref, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD );
+  CHECK( npts == npts_ref );
+#endif
+
+}
+
+TEST_CASE( "LoadBalancer Basis Update", "[load_balancer]" ) {
+
+  auto world = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  Molecule mol = make_water();
+
+  // Same shells with a tighter screening extent
+  auto basis_compact = make_631Gd( mol, SphericalType(false) );
+  auto basis         = basis_compact;
+  for( auto& sh : basis )
+    sh.set_shell_tolerance( std::numeric_limits<double>::epsilon() );
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb = lb_factory.get_instance( world, mol, mg, basis );
+
+  auto gather_points = []( const std::vector<XCTask>& tasks ) {
+    std::vector<std::array<double,4>> pts;
+    for( const auto& t : tasks ) {
+      CHECK( t.bfn_screening.nbe > 0 );
+      for( size_t i = 0; i < t.points.size(); ++i )
+        pts.push_back({ t.points[i][0], t.points[i][1], t.points[i][2],
+          t.weights[i] });
+    }
+    std::sort( pts.begin(), pts.end() );
+    return pts;
+  };
+  auto total_nbe = []( const std::vector<XCTask>& tasks ) {
+    size_t nbe = 0;
+    for( const auto& t : tasks ) nbe += t.points.size() * t.bfn_screening.nbe;
+    return nbe;
+  };
+
+  const auto pts = gather_points( lb.get_tasks() );
+  const auto nbe = total_nbe( lb.get_tasks() );
+  lb.state().modified_weights_are_stored = true;
+
+  lb.update_basis( basis_compact );
+  auto lb_ref = lb_factory.get_instance( world, mol, mg, basis_compact );
+
+  // Weights are kept for a more compact basis
+  CHECK( lb.state().modified_weights_are_stored );
+  CHECK( lb.basis() == basis_compact );
+
+  const auto& tasks = lb.get_tasks();
+  for( const auto& t : tasks )
+    CHECK( t.npts == int32_t(t.points.size()) );
+  CHECK( total_nbe( tasks ) <= nbe );
+
+  // Subset of the original quadrature. Tasks are screened against their 
+  // points rather than their batch, the points of a LoadBalancer generated 
+  // for the new basis which are not kept are negligible
+  auto pts_new = gather_points( tasks );
+  auto pts_ref = gather_points( lb_ref.get_tasks() );
+  CHECK( std::includes( pts.begin(), pts.end(), pts_new.begin(), pts_new.end() ) );
+  if( world.comm_size() == 1 ) {
+    const detail::ShellSpatialIndex shell_index( basis_compact );
+    for( const auto& p : pts_ref ) 
+    if( not std::binary_search( pts_new.begin(), pts_new.end(), p ) ) {
+      const std::array<double,3> pt = { p[0], p[1], p[2] };
+      CHECK( shell_index.query( pt, pt ).empty() );
+    }
+  }
+
+}
+
+TEST_CASE( "LoadBalancer Task Size Adaptation", "[load_balancer]" ) {
+
+  auto world = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  Molecule mol           = make_benzene();
+  BasisSet<double> basis = make_ccpvdz( mol, SphericalType(true) );
+
+  for( auto& sh : basis ) 
+    sh.set_shell_tolerance( std::numeric_limits<double>::epsilon() );
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb = lb_factory.get_instance( world, mol, mg, basis );
+
+  const size_t natoms = mol.natoms();
+  auto task_costs = [&]( const auto& tasks ) {
+    std::vector<size_t> costs;
+    for( const auto& t : tasks ) costs.emplace_back( t.cost(1, natoms) );
+    std::sort( costs.begin(), costs.end() );
+    return costs;
+  };
+  auto gather_points = []( const auto& tasks ) {
+    std::vector<std::array<double,4>> pts;
+    for( const auto& t : tasks ) 
+    for( size_t i = 0; i < t.points.size(); ++i )
+      pts.push_back({ t.points[i][0], t.points[i][1], t.points[i][2], 
+        t.weights[i] });
+    std::sort( pts.begin(), pts.end() );
+    return pts;
+  };
+
+  const auto costs = task_costs( lb.get_tasks() );
+  const auto pts   = gather_points( lb.get_tasks() );
+
+  // Window around the median task cost
+  const size_t min_cost = costs[costs.size()/2] / 2;
+  const size_t max_cost = costs[costs.size()/2] * 2;
+  lb.adapt_task_sizes( min_cost, max_cost );
+
+  const auto& tasks = lb.get_tasks();
+  CHECK( gather_points(tasks) == pts );
+  for( const auto& t : tasks ) {
+    CHECK( t.npts == int32_t(t.points.size()) );
+    CHECK( t.bfn_screening.nbe > 0 );
+    if( t.points.size() > 1 ) CHECK( t.cost(1, natoms) <= max_cost );
+  }
+
+  const auto new_costs = task_costs( tasks );
+  auto nsmall = []( const auto& c, size_t min_c ) { 
+    return std::count_if( c.begin(), c.end(), [=](auto x){ return x < min_c; } ); 
+  };
+  CHECK( nsmall(new_costs, min_cost) <= nsmall(costs, min_cost) );
+
+}
+
+TEST_CASE( "LoadBalancer Task Compaction", "[load_balancer]" ) {
+
+  auto world = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  Molecule mol           = make_water();
+  BasisSet<double> basis = make_631Gd( mol, SphericalType(false) );
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb     = lb_factory.get_instance( world, mol, mg, basis );
+  auto lb_ref = lb_factory.get_instance( world, mol, mg, basis );
+
+  // SSF weights vanish exactly for the points closer to another atom
+  const double weight_tol = 0.;
+  MolecularWeightsSettings mw_settings;
+  MolecularWeightsFactory( ExecutionSpace::Host, "Default", mw_settings )
+    .get_instance().modify_weights( lb_ref );
+  mw_settings.compact_tasks  = true;
+  mw_settings.compaction_tol = weight_tol;
+  MolecularWeightsFactory( ExecutionSpace::Host, "Default", mw_settings )
+    .get_instance().modify_weights( lb );
+
+  auto gather_points = []( const std::vector<XCTask>& tasks, double tol ) {
+    std::vector<std::array<double,4>> pts;
+    for( const auto& t : tasks )
+    for( size_t i = 0; i < t.points.size(); ++i )
+      if( std::abs(t.weights[i]) > tol )
+        pts.push_back({ t.points[i][0], t.points[i][1], t.points[i][2],
+          t.weights[i] });
+    std::sort( pts.begin(), pts.end() );
+    return pts;
+  };
+
+  const auto& tasks     = lb.get_tasks();
+  const auto& tasks_ref = lb_ref.get_tasks();
+  CHECK( tasks.size() <= tasks_ref.size() );
+  for( const auto& t : tasks ) {
+    CHECK( t.npts == int32_t(t.points.size()) );
+    CHECK( t.bfn_screening.nbe > 0 );
+  }
+
+  // Only the negligible points are removed
+  size_t npts = 0, npts_ref = 0;
+  for( const auto& t : tasks )     npts     += t.points.size();
+  for( const auto& t : tasks_ref ) npts_ref += t.points.size();
+  CHECK( npts < npts_ref );
+  if( world.comm_size() == 1 )
+    CHECK( gather_points( tasks, -1. ) == gather_points( tasks_ref, weight_tol ) );
+  CHECK( lb.state().tasks_compacted );
+
+  // A basis update keeps the compacted tasks and their weights
+  lb.update_basis( basis );
+  CHECK( lb.state().tasks_compacted );
+  CHECK( lb.state().modified_weights_are_stored );
+  size_t npts_basis = 0;
+  for( const auto& t : lb.get_tasks() ) npts_basis += t.points.size();
+  CHECK( npts_basis == npts );
+
+  // The removed points are restored by a geometry update
+  Molecule mol_new = mol;
+  mol_new[1].x += 0.05; mol_new[1].y -= 0.04;
+
+  lb.update_geometry( mol_new );
+  CHECK( not lb.state().tasks_compacted );
+  CHECK( not lb.state().modified_weights_are_stored );
+  auto lb_new = lb_factory.get_instance( world, mol_new, mg, lb.basis() );
+
+  const auto& tasks_upd = lb.get_tasks();
+  const auto& tasks_new = lb_new.get_tasks();
+  size_t npts_upd = 0, npts_new = 0;
+  for( const auto& t : tasks_upd ) npts_upd += t.points.size();
+  for( const auto& t : tasks_new ) npts_new += t.points.size();
+  CHECK( npts_upd == npts_new );
+  if( world.comm_size() == 1 )
+    CHECK( gather_points( tasks_upd, -1. ) == gather_points( tasks_new, -1. ) );
+
+}
+
+TEST_CASE( "LoadBalancer Task Reordering", "[load_balancer]" ) {
+
+  auto world = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  Molecule mol           = make_water();
+  BasisSet<double> basis = make_631Gd( mol, SphericalType(false) );
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb = lb_factory.get_instance( world, mol, mg, basis );
+
+  CHECK( not lb.tasks_generated() );
+  lb.get_tasks();
+  CHECK( lb.tasks_generated() );
+
+  const auto& tasks = std::as_const(lb).get_tasks();
+  const auto  ref   = tasks;
+  const auto  ntasks = tasks.size();
+  const auto  generation = lb.generation();
+
+  // The identity leaves the generation unchanged
+  std::vector<size_t> perm( ntasks );
+  std::iota( perm.begin(), perm.end(), 0 );
+  lb.reorder_tasks( perm );
+  CHECK( lb.generation() == generation );
+
+  // Any other order increments it
+  std::reverse( perm.begin(), perm.end() );
+  lb.reorder_tasks( perm );
+  if( ntasks > 1 ) CHECK( lb.generation() > generation );
+  for( size_t i = 0; i < ntasks; ++i ) {
+    CHECK( tasks[i].points == ref[perm[i]].points );
+    CHECK( tasks[i].bfn_screening.shell_list == 
+      ref[perm[i]].bfn_screening.shell_list );
+  }
+
+  perm.pop_back();
+  if( ntasks ) CHECK_THROWS( lb.reorder_tasks( perm ) );
+
+}
+
+TEST_CASE( "LoadBalancer Rebalance", "[load_balancer]" ) {
+
+  auto world = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+  const int world_rank = world.comm_rank();
+  const int world_size = world.comm_size();
+
+  Molecule mol           = make_water();
+  BasisSet<double> basis = make_631Gd( mol, SphericalType(false) );
+  const size_t natoms    = mol.natoms();
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb = lb_factory.get_instance( world, mol, mg, basis );
+
+  // Imbalance the tasks: rank i keeps the first 1/(i+1) of its tasks
+  {
+    auto tasks = lb.get_tasks();
+    tasks.erase( tasks.begin() + tasks.size() / (world_rank + 1), tasks.end() );
+    lb.set_tasks( std::move(tasks) );
+  }
+
+  auto global_ntasks = [&]() {
+    size_t ntasks = lb.get_tasks().size();
+#ifdef GAUXC_HAS_MPI
+    MPI_Allreduce( MPI_IN_PLACE, &ntasks, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD );
+#endif
+    return ntasks;
+  };
+
+  auto global_points = [&]() {
+    std::vector<std::array<double,4>> pts;
+    for( const auto& t : lb.get_tasks() )
+    for( size_t i = 0; i < t.points.size(); ++i )
+      pts.push_back({ t.points[i][0], t.points[i][1], t.points[i][2],
+        t.weights[i] });
+#ifdef GAUXC_HAS_MPI
+    int count = 4 * pts.size();
+    std::vector<int> counts( world_size ), displs( world_size, 0 );
+    MPI_Allgather( &count, 1, MPI_INT, counts.data(), 1, MPI_INT, MPI_COMM_WORLD );
+    std::partial_sum( counts.begin(), counts.end() - 1, displs.begin() + 1 );
+    std::vector<std::array<double,4>> pts_global(
+      (displs.back() + counts.back()) / 4 );
+    MPI_Allgatherv( pts.data(), count, MPI_DOUBLE, pts_global.data(),
+      counts.data(), displs.data(), MPI_DOUBLE, MPI_COMM_WORLD );
+    pts = std::move(pts_global);
+#endif
+    std::sort( pts.begin(), pts.end() );
+    return pts;
+  };
+
+  // (max - min) / total of the local task costs
+  auto cost_spread = [&]( const auto& cost ) {
+    size_t local_cost = 0;
+    for( const auto& t : lb.get_tasks() ) local_cost += cost(t);
+    size_t cost_max = local_cost, cost_min = local_cost, cost_sum = local_cost;
+#ifdef GAUXC_HAS_MPI
+    MPI_Allreduce( MPI_IN_PLACE, &cost_max, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD );
+    MPI_Allreduce( MPI_IN_PLACE, &cost_min, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD );
+    MPI_Allreduce( MPI_IN_PLACE, &cost_sum, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD );
+#endif
+    REQUIRE( cost_sum > 0 );
+    return double(cost_max - cost_min) / cost_sum;
+  };
+
+  auto check_rebalance = [&]( const auto& rebalance, const auto& cost ) {
+    const auto ntasks = global_ntasks();
+    const auto pts    = global_points();
+    const auto spread = cost_spread( cost );
+
+    rebalance();
+
+    CHECK( global_ntasks() == ntasks );
+    CHECK( global_points() == pts );
+    if( world_size > 1 ) CHECK( cost_spread( cost ) < spread );
+    else                 CHECK( cost_spread( cost ) == 0. );
+  };
+
+  SECTION( "Weights" ) {
+    check_rebalance( [&](){ lb.rebalance_weights(); },
+      [&]( const XCTask& t ){ return t.cost( 1, natoms ); } );
+  }
+
+  SECTION( "EXC/VXC" ) {
+    check_rebalance( [&](){ lb.rebalance_exc_vxc(); },
+      []( const XCTask& t ){ return t.cost_exc_vxc( 1 ); } );
+  }
+
+  SECTION( "EXX" ) {
+    check_rebalance( [&](){ lb.rebalance_exx(); },
+      []( const XCTask& t ){ return t.cost_exx(); } );
+  }
+
+}
+
+TEST_CASE( "ShellSpatialIndex", "[load_balancer]" ) {
+
+  Molecule mol           = make_benzene();
+  BasisSet<double> basis = make_ccpvdz( mol, SphericalType(true) );
+  const size_t nshells   = basis.size();
+  REQUIRE( nshells > detail::ShellSpatialIndex::leaf_size );
+
+  const detail::ShellSpatialIndex index( basis );
+
+  // Brute force box / cutoff sphere overlap
+  auto query_ref = [&]( const auto& lo, const auto& up ) {
+    std::vector<int32_t> shell_list;
+    for( size_t i = 0; i < nshells; ++i )
+    if( geometry::cube_sphere_intersect( lo, up, basis[i].O(), 
+        basis[i].cutoff_radius() ) )
+      shell_list.emplace_back( i );
+    return shell_list;
+  };
+
+  // Random boxes (from points to boxes enclosing the molecule) around the
+  // molecule, including boxes which intersect no shell
+  std::default_random_engine gen;
+  std::uniform_real_distribution<> center_dist( -20., 20. );
+  std::uniform_real_distribution<> extent_dist( 0., 10. );
+
+  size_t nnonempty = 0;
+  for( int itest = 0; itest < 1000; ++itest ) {
+    std::array<double,3> lo, up;
+    for( int k = 0; k < 3; ++k ) {
+      const double c = center_dist(gen);
+      const double e = itest % 10 ? extent_dist(gen) : 0.;
+      lo[k] = c - e; up[k] = c + e;
+    }
+    const auto shell_list = index.query( lo, up );
+    CHECK( shell_list == query_ref( lo, up ) );
+    if( shell_list.size() ) ++nnonempty;
+  }
+  CHECK( nnonempty > 0 );
+
+  // Empty basis
+  CHECK( detail::ShellSpatialIndex().query( {0.,0.,0.}, {1.,1.,1.} ).empty() );
+
+}
+
+TEST_CASE( "XCTaskArena", "[load_balancer]" ) {
+
+  auto world = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  Molecule mol           = make_water();
+  BasisSet<double> basis = make_631Gd( mol, SphericalType(false) );
+
+  for( auto& sh : basis ) 
+    sh.set_shell_tolerance( std::numeric_limits<double>::epsilon() );
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb = lb_factory.get_instance( world, mol, mg, basis );
+
+  // Populate the EXX screening data of the tasks
+  auto tasks = lb.get_tasks();
+  for( auto& task : tasks ) {
+    auto& cou = task.cou_screening;
+    cou.shell_list = task.bfn_screening.shell_list;
+    cou.nbe        = task.bfn_screening.nbe;
+    for( size_t i = 0; i < cou.shell_list.size(); ++i ) 
+    for( size_t j = 0; j <= i; ++j ) {
+      cou.shell_pair_list.emplace_back( cou.shell_list[i], cou.shell_list[j] );
+      cou.shell_pair_idx_list.emplace_back( cou.shell_pair_idx_list.size() );
+    }
+    task.cost_exx_measured = 1e-3 * task.npts;
+  }
+
+  auto check_tasks = [&]( const std::vector<XCTask>& ref, 
+    const std::vector<XCTask>& chk ) {
+    REQUIRE( chk.size() == ref.size() );
+    for( size_t i = 0; i < ref.size(); ++i ) {
+      const auto& a = ref[i]; const auto& b = chk[i];
+      CHECK( a.iParent == b.iParent );
+      CHECK( a.npts == b.npts );
+      CHECK( a.points == b.points );
+      CHECK( a.weights == b.weights );
+      CHECK( a.dist_nearest == b.dist_nearest );
+      CHECK( a.max_weight == b.max_weight );
+      CHECK( a.cost_exx_measured == b.cost_exx_measured );
+      CHECK( a.bfn_screening.nbe == b.bfn_screening.nbe );
+      CHECK( a.bfn_screening.shell_list == b.bfn_screening.shell_list );
+      CHECK( a.protonic_bfn_screening.nbe == b.protonic_bfn_screening.nbe );
+      CHECK( a.protonic_bfn_screening.shell_list == 
+             b.protonic_bfn_screening.shell_list );
+      CHECK( a.cou_screening.nbe == b.cou_screening.nbe );
+      CHECK( a.cou_screening.shell_list == b.cou_screening.shell_list );
+      CHECK( a.cou_screening.shell_pair_list == 
+             b.cou_screening.shell_pair_list );
+      CHECK( a.cou_screening.shell_pair_idx_list == 
+             b.cou_screening.shell_pair_idx_list );
+    }
+  };
+
+  detail::XCTaskArena arena( tasks.begin(), tasks.end() );
+  REQUIRE( arena.size() == tasks.size() );
+
+  SECTION("Unpack") {
+    std::vector<XCTask> unpacked;
+    arena.unpack( unpacked );
+    check_tasks( tasks, unpacked );
+  }
+
+  SECTION("Buffer Copy") {
+    // Copy buffer-by-buffer as is done for MPI transfers
+    detail::XCTaskArena copy;
+    copy.resize( arena.extents() );
+
+    std::vector<std::pair<void*,size_t>> src;
+    arena.for_each_buffer( [&]( void* ptr, size_t n ){ src.emplace_back(ptr,n); } );
+    size_t ibuf = 0;
+    copy.for_each_buffer( [&]( void* ptr, size_t n ) {
+      REQUIRE( n == src[ibuf].second );
+      if( n ) std::memcpy( ptr, src[ibuf].first, n );
+      ibuf++;
+    });
+
+    std::vector<XCTask> unpacked;
+    copy.unpack( unpacked );
+    check_tasks( tasks, unpacked );
+  }
+
+}
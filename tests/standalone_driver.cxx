@@ -104,6 +104,20 @@ int main(int argc, char** argv) {
     IntegratorSettingsSNLinK sn_link_settings;
     OPTIONAL_KEYWORD( "EXX.TOL_E", sn_link_settings.energy_tol, double );
     OPTIONAL_KEYWORD( "EXX.TOL_K", sn_link_settings.k_tol,      double );
+    OPTIONAL_KEYWORD( "EXX.TOL_MP", sn_link_settings.multipole_tol, double );
+    OPTIONAL_KEYWORD( "EXX.OMEGA",  sn_link_settings.omega, double );
+    OPTIONAL_KEYWORD( "EXX.ALPHA",  sn_link_settings.alpha, double );
+    OPTIONAL_KEYWORD( "EXX.BETA",   sn_link_settings.beta,  double );
+
+    std::string exx_engine_str = "AUTO";
+    OPTIONAL_KEYWORD( "EXX.ENGINE", exx_engine_str, std::string );
+    string_to_upper( exx_engine_str );
+    std::map< std::string, ShellPairIntegralEngine > exx_engine_map = {
+      { "AUTO",        ShellPairIntegralEngine::Auto       },
+      { "OBARA_SAIKA", ShellPairIntegralEngine::ObaraSaika },
+      { "RYS",         ShellPairIntegralEngine::Rys        }
+    };
+    sn_link_settings.integral_engine = exx_engine_map.at(exx_engine_str);
 
 
     #ifdef GAUXC_HAS_DEVICE
@@ -141,7 +155,17 @@ int main(int argc, char** argv) {
                   std::cout << "  EXX.TOL_E         = " 
                             << sn_link_settings.energy_tol << std::endl
                             << "  EXX.TOL_K         = " 
-                            << sn_link_settings.k_tol << std::endl;
+                            << sn_link_settings.k_tol << std::endl
+                            << "  EXX.TOL_MP        = " 
+                            << sn_link_settings.multipole_tol << std::endl
+                            << "  EXX.ENGINE        = " 
+                            << exx_engine_str << std::endl
+                            << "  EXX.OMEGA         = " 
+                            << sn_link_settings.omega << std::endl
+                            << "  EXX.ALPHA         = " 
+                            << sn_link_settings.alpha << std::endl
+                            << "  EXX.BETA          = " 
+                            << sn_link_settings.beta << std::endl;
                 }
                 std::cout << std::endl;
     }
@@ -54,11 +54,34 @@ TEST_CASE( "Partition Weights", "[weights]" ) {
                           std::ios::binary );
   test_host_weights( ref_data, XCWeightAlg::Becke );
   }
+  SECTION("Becke Neighbor List") {
+  std::ifstream ref_data( GAUXC_REF_DATA_PATH "/benzene_weights_becke.bin", 
+                          std::ios::binary );
+  test_host_weights( ref_data, XCWeightAlg::Becke, true );
+  }
+  SECTION("Becke Neighbor List Screening") {
+  test_host_weights_screened( XCWeightAlg::Becke );
+  }
+  SECTION("Becke SIMD") {
+  std::ifstream ref_data( GAUXC_REF_DATA_PATH "/benzene_weights_becke.bin", 
+                          std::ios::binary );
+  test_host_weights( ref_data, XCWeightAlg::Becke, false, "SIMD" );
+  }
+  SECTION("Becke Gradient") {
+  std::ifstream ref_data( GAUXC_REF_DATA_PATH "/benzene_weights_becke.bin", 
+                          std::ios::binary );
+  test_host_weights_gradient( ref_data, XCWeightAlg::Becke );
+  }
   SECTION("LKO") {
   std::ifstream ref_data( GAUXC_REF_DATA_PATH "/benzene_weights_lko.bin", 
                           std::ios::binary );
   test_host_weights( ref_data, XCWeightAlg::LKO );
   }
+  SECTION("LKO SIMD") {
+  std::ifstream ref_data( GAUXC_REF_DATA_PATH "/benzene_weights_lko.bin", 
+                          std::ios::binary );
+  test_host_weights( ref_data, XCWeightAlg::LKO, false, "SIMD" );
+  }
 #endif
 
 
@@ -71,6 +94,15 @@ TEST_CASE( "Partition Weights", "[weights]" ) {
   SECTION( "Host Weights" ) {
     test_host_weights( ref_data, XCWeightAlg::SSF );
   }
+  SECTION( "Host Neighbor List Weights" ) {
+    test_host_weights( ref_data, XCWeightAlg::SSF, true );
+  }
+  SECTION( "Host SIMD Weights" ) {
+    test_host_weights( ref_data, XCWeightAlg::SSF, false, "SIMD" );
+  }
+  SECTION( "Host Weights Gradient" ) {
+    test_host_weights_gradient( ref_data, XCWeightAlg::SSF );
+  }
 #endif
 
 #ifdef GAUXC_HAS_DEVICE
@@ -7,14 +7,21 @@
  */
 #pragma once
 #include "weights_generate.hpp"
+#include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <numeric>
 #include <string>
 
 #ifdef GAUXC_HAS_HOST
-#include "host/reference/weights.hpp"
+#include <gauxc/xc_integrator/local_work_driver.hpp>
+#include "host/local_host_work_driver.hpp"
+#include "host/reference/weights_neighbor_list.hpp"
+#include "common/integrator_constants.hpp"
 using namespace GauXC;
 
-void test_host_weights( std::ifstream& in_file, XCWeightAlg weight_alg ) {
+void test_host_weights( std::ifstream& in_file, XCWeightAlg weight_alg,
+  bool neighbor_list = false, std::string kernel = "Reference" ) {
 
   ref_weights_data ref_data;
   {
@@ -22,36 +29,172 @@ void test_host_weights( std::ifstream& in_file, XCWeightAlg weight_alg ) {
     ar( ref_data );
   }
 
-  switch(weight_alg) {
-    case XCWeightAlg::Becke:
-      reference_becke_weights_host( 
-        ref_data.mol, *ref_data.meta, ref_data.tasks_unm.begin(), 
-        ref_data.tasks_unm.end() );
-      break;
-    case XCWeightAlg::SSF:
-      reference_ssf_weights_host( 
-        ref_data.mol, *ref_data.meta, ref_data.tasks_unm.begin(), 
-        ref_data.tasks_unm.end() );
-      break;
-    case XCWeightAlg::LKO:
-      reference_lko_weights_host( 
-        ref_data.mol, *ref_data.meta, ref_data.tasks_unm.begin(), 
-        ref_data.tasks_unm.end() );
-      break;
-  }
+  auto quad_tasks = ref_data.tasks_unm; // Quadrature weights
+
+  auto lwd = LocalWorkDriverFactory::make_local_work_driver( 
+    ExecutionSpace::Host, kernel );
+  auto* host_lwd = dynamic_cast<LocalHostWorkDriver*>(lwd.get());
+  host_lwd->partition_weights( weight_alg, ref_data.mol, *ref_data.meta,
+    ref_data.tasks_unm.begin(), ref_data.tasks_unm.end(), neighbor_list );
 
 
   size_t ntasks = ref_data.tasks_unm.size();
   for( size_t itask = 0; itask < ntasks; ++itask ) {
     auto& task     = ref_data.tasks_unm.at(itask);
     auto& ref_task = ref_data.tasks_mod.at(itask);
+    auto& quad_task = quad_tasks.at(itask);
 
     size_t npts = task.weights.size();
     for( size_t i = 0; i < npts; ++i ) {
+      // Neighbor list and SIMD partition weights are exact up to the
+      // screening tolerances
+      const bool exact  = not neighbor_list and kernel == "Reference";
+      const auto margin = exact ? 0. : 1e-8 * std::abs(quad_task.weights.at(i));
       CHECK( task.weights.at(i) ==
-             Approx(ref_task.weights.at(i)) );
+             Approx(ref_task.weights.at(i)).margin(margin) );
+    }
+  }
+
+}
+
+void test_host_weights_screened( XCWeightAlg weight_alg ) {
+
+  // Linear hydrogen chain, long enough for atoms to be screened for the
+  // points near the nuclei
+  const size_t natoms = 32;
+  Molecule mol;
+  for( size_t i = 0; i < natoms; ++i )
+    mol.emplace_back( AtomicNumber(1), 1.4 * i, 0.1 * (i % 2), 0. );
+  MolMeta meta( mol );
+
+  // Points from the nuclei up to beyond the chain
+  std::vector<XCTask> tasks( natoms );
+  for( size_t iA = 0; iA < natoms; ++iA ) {
+    auto& task = tasks[iA];
+    task.iParent      = iA;
+    task.dist_nearest = meta.dist_nearest()[iA];
+    for( double r : { 0.01, 0.05, 0.2, 0.6, 2., 10., 40. } ) {
+      task.points.push_back( { mol[iA].x + 0.3*r, mol[iA].y + 0.5*r, 
+        mol[iA].z + 0.8*r } );
+      task.weights.push_back( 1. );
     }
   }
 
+  // The screening drops atoms
+  const PartitionNeighborList neighbors( mol, meta );
+  std::vector<int32_t> idx( natoms );
+  std::vector<double>  dist( natoms );
+  size_t nscreened = 0;
+  for( auto& task : tasks )
+  for( auto& point : task.points ) {
+    double r_nearest;
+    const auto n = neighbors.collect( mol, point, task.iParent, 
+      integrator::becke_neighbor_ratio, idx.data(), dist.data(), r_nearest );
+    REQUIRE( idx[0] == task.iParent );
+
+    // Exactly the atoms within the cutoff are collected
+    std::vector<int32_t> ref_idx;
+    for( size_t iA = 0; iA < natoms; ++iA ) {
+      const double dx = point[0] - mol[iA].x;
+      const double dy = point[1] - mol[iA].y;
+      const double dz = point[2] - mol[iA].z;
+      const double r  = std::sqrt( dx*dx + dy*dy + dz*dz );
+      if( r < integrator::becke_neighbor_ratio * r_nearest or 
+          int32_t(iA) == task.iParent ) ref_idx.push_back( iA );
+    }
+    std::sort( idx.begin(), idx.begin() + n );
+    CHECK( std::vector<int32_t>( idx.begin(), idx.begin() + n ) == ref_idx );
+
+    if( n < natoms ) nscreened++;
+  }
+  CHECK( nscreened >= 2 * natoms );
+
+  // Screened weights agree with the unscreened ones to ~natoms * 1e-12
+  auto lwd = LocalWorkDriverFactory::make_local_work_driver( 
+    ExecutionSpace::Host, "Reference" );
+  auto* host_lwd = dynamic_cast<LocalHostWorkDriver*>(lwd.get());
+
+  auto ref_tasks = tasks;
+  host_lwd->partition_weights( weight_alg, mol, meta, ref_tasks.begin(),
+    ref_tasks.end() );
+  host_lwd->partition_weights( weight_alg, mol, meta, tasks.begin(),
+    tasks.end(), true );
+
+  for( size_t iT = 0; iT < natoms; ++iT )
+  for( size_t i = 0; i < tasks[iT].weights.size(); ++i )
+    CHECK( tasks[iT].weights[i] == 
+           Approx(ref_tasks[iT].weights[i]).margin(natoms * 1e-12) );
+
+}
+
+void test_host_weights_gradient( std::ifstream& in_file, 
+  XCWeightAlg weight_alg ) {
+
+  ref_weights_data ref_data;
+  {
+    cereal::BinaryInputArchive ar( in_file );
+    ar( ref_data );
+  }
+
+  auto lwd = LocalWorkDriverFactory::make_local_work_driver( 
+    ExecutionSpace::Host, "Reference" );
+  auto* host_lwd = dynamic_cast<LocalHostWorkDriver*>(lwd.get());
+
+  // Integral of unity with the quadrature points moving along with their
+  // parent atom
+  auto integrate = [&]( const Molecule& mol, std::vector<XCTask> tasks ) {
+    MolMeta meta( mol );
+    for( auto& task : tasks ) 
+      task.dist_nearest = meta.dist_nearest()[task.iParent];
+    host_lwd->partition_weights( weight_alg, mol, meta, tasks.begin(),
+      tasks.end() );
+
+    double sum = 0.;
+    for( auto& task : tasks ) 
+      sum = std::accumulate( task.weights.begin(), task.weights.end(), sum );
+    return sum;
+  };
+
+  const auto& mol = ref_data.mol;
+  const auto natoms = mol.natoms();
+
+  auto tasks = ref_data.tasks_unm;
+  host_lwd->partition_weights( weight_alg, mol, *ref_data.meta, tasks.begin(),
+    tasks.end() );
+
+  size_t npts = 0;
+  for( auto& task : tasks ) npts += task.points.size();
+  std::vector<double> f( npts, 1. ), grad( 3*natoms, 0. );
+  host_lwd->partition_weights_gradient( weight_alg, mol, *ref_data.meta, 
+    tasks.begin(), tasks.end(), f.data(), grad.data() );
+
+  // Central finite differences
+  const double h = 1e-5;
+  for( size_t iA = 0; iA < natoms; ++iA )
+  for( int x = 0; x < 3; ++x ) {
+    auto displace = [&]( double dx ) {
+      auto mol_d = mol;
+      auto& atom = mol_d[iA];
+      (x == 0 ? atom.x : x == 1 ? atom.y : atom.z) += dx;
+
+      auto tasks_d = ref_data.tasks_unm;
+      for( auto& task : tasks_d ) 
+      if( task.iParent == int32_t(iA) ) {
+        for( auto& pt : task.points ) pt[x] += dx;
+      }
+      return integrate( mol_d, tasks_d );
+    };
+
+    const double fd = (displace(h) - displace(-h)) / (2*h);
+    CHECK( grad[3*iA + x] == Approx(fd).margin(1e-10) );
+  }
+
+  // Translational invariance
+  for( int x = 0; x < 3; ++x ) {
+    double sum = 0.;
+    for( size_t iA = 0; iA < natoms; ++iA ) sum += grad[3*iA + x];
+    CHECK( sum == Approx(0.).margin(1e-10) );
+  }
+
 }
 #endif
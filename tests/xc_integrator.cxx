@@ -16,6 +16,15 @@
 #include <gauxc/external/hdf5.hpp>
 #include <highfive/H5File.hpp>
 #include <Eigen/Core>
+#include <cmath>
+
+#ifdef GAUXC_HAS_HOST
+#include <gauxc/xc_integrator/local_work_driver.hpp>
+#include <gauxc/shell_pair.hpp>
+#include <gauxc/basisset_map.hpp>
+#include "host/local_host_work_driver.hpp"
+#include "host/shell_pair_engine.hpp"
+#endif
 
 using namespace GauXC;
 
@@ -258,6 +267,25 @@ void test_xc_integrator( ExecutionSpace ex, const RuntimeEnvironment& rt,
       }
     }
 
+    // Check space filling curve task orderings
+    if( ex == ExecutionSpace::Host and not neo ) 
+    for( auto ordering : { TaskOrdering::Morton, TaskOrdering::Hilbert } ) {
+      IntegratorSettingsKS ks_settings;
+      ks_settings.task_ordering = ordering;
+      auto [ EXC1, VXC1 ] = integrator->eval_exc_vxc( P, ks_settings );
+      CHECK( EXC1 == Approx( EXC_ref ) );
+      CHECK( ( VXC1 - VXC_ref ).norm() / basis.nbf() < 1e-10 );
+    }
+
+    // Check inter-rank work stealing
+    if( ex == ExecutionSpace::Host and not neo ) {
+      IntegratorSettingsKS ks_settings;
+      ks_settings.inter_rank_work_stealing = true;
+      auto [ EXC1, VXC1 ] = integrator->eval_exc_vxc( P, ks_settings );
+      CHECK( EXC1 == Approx( EXC_ref ) );
+      CHECK( ( VXC1 - VXC_ref ).norm() / basis.nbf() < 1e-10 );
+    }
+
     // Check EXC-only path
     if(neo) return; // NEO EXC-only NYI
     auto EXC2 = integrator->eval_exc( P );
@@ -355,6 +383,44 @@ void test_xc_integrator( ExecutionSpace ex, const RuntimeEnvironment& rt,
     map_type EXC_GRAD_map( EXC_GRAD.data(), mol.size(), 3 );
     auto EXC_GRAD_diff_nrm = (EXC_GRAD_ref_map - EXC_GRAD_map).norm();
     CHECK( EXC_GRAD_diff_nrm / std::sqrt(3.0*mol.size()) < 1e-10 );
+
+    // With the weight derivatives, the gradient is translationally invariant
+    if( ex == ExecutionSpace::Host ) {
+      IntegratorSettingsKS ks_settings;
+      ks_settings.weight_derivatives = true;
+      auto EXC_GRAD_W = integrator->eval_exc_grad( P, ks_settings );
+      for( int x = 0; x < 3; ++x ) {
+        double sum = 0.;
+        for( size_t iA = 0; iA < mol.size(); ++iA ) sum += EXC_GRAD_W[3*iA + x];
+        CHECK( sum == Approx(0.).margin(1e-10) );
+      }
+
+      // Finite difference of EXC w.r.t. the position of the first atom on
+      // a smaller grid, the quadrature (and basis) move with the atoms
+      auto mg_fd = MolGridFactory::create_default_molgrid(mol, pruning_scheme,
+        BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid);
+      auto lb_fd = lb_factory.get_instance( rt, mol, mg_fd, basis );
+      mw.modify_weights( lb_fd );
+      auto EXC_GRAD_FD = integrator_factory.get_instance( *func, lb_fd )
+        .eval_exc_grad( P, ks_settings );
+
+      const double h = 1e-4;
+      auto eval_exc_displaced = [&]( int x, double dx ) {
+        Molecule mol_dx = mol;
+        (x == 0 ? mol_dx[0].x : x == 1 ? mol_dx[0].y : mol_dx[0].z) += dx;
+        LoadBalancer lb_dx( lb_fd );
+        lb_dx.update_geometry( mol_dx );
+        mw.modify_weights( lb_dx );
+        auto integrator_dx = integrator_factory.get_instance( *func, lb_dx );
+        return std::get<0>( integrator_dx.eval_exc_vxc( P ) );
+      };
+
+      for( int x = 0; x < 3; ++x ) {
+        const double fd =
+          ( eval_exc_displaced( x, h ) - eval_exc_displaced( x, -h ) ) / (2*h);
+        CHECK( EXC_GRAD_FD[x] == Approx( fd ).margin(1e-6) );
+      }
+    }
   }
 
   // Check K
@@ -364,9 +430,171 @@ void test_xc_integrator( ExecutionSpace ex, const RuntimeEnvironment& rt,
       std::cout << "Skiping device sn-K + L > 2" << std::endl;
       return;
     }
+    const auto xc_tasks = integrator->load_balancer().get_tasks();
     auto K = integrator->eval_exx( P );
     CHECK((K - K.transpose()).norm() < std::numeric_limits<double>::epsilon()); // Symmetric
     CHECK( (K - K_ref).norm() / basis.nbf() < 1e-7 );
+
+    // EXX must not modify the load balancer tasks
+    if( ex == ExecutionSpace::Host and integrator_kernel == "Default" ) {
+      const auto& tasks = integrator->load_balancer().get_tasks();
+      REQUIRE( tasks.size() == xc_tasks.size() );
+      for( size_t i = 0; i < tasks.size(); ++i ) {
+        CHECK( tasks[i].iParent == xc_tasks[i].iParent );
+        CHECK( tasks[i].points  == xc_tasks[i].points );
+      }
+
+      // Measured task costs for rebalance_exx
+      CHECK( integrator->load_balancer().state().exx_costs_measured );
+      double cost_sum = 0.;
+      for( const auto& task : tasks ) {
+        CHECK( task.cost_exx_measured >= 0. );
+        cost_sum += task.cost_exx_measured;
+      }
+      CHECK( cost_sum > 0. );
+
+      // Cached task view
+      auto K_cached = integrator->eval_exx( P );
+      CHECK( (K_cached - K).norm() / basis.nbf() < 1e-12 );
+
+      // Rebalancing on the measured costs conserves the tasks
+      {
+        auto& lb_exx = integrator->load_balancer();
+        auto global_counts = [&]() {
+          const auto& lb_tasks = std::as_const(lb_exx).get_tasks();
+          std::array<size_t,2> counts = { lb_tasks.size(), 0ul };
+          for( const auto& task : lb_tasks ) counts[1] += task.points.size();
+#ifdef GAUXC_HAS_MPI
+          MPI_Allreduce( MPI_IN_PLACE, counts.data(), 2, MPI_UINT64_T, MPI_SUM,
+            MPI_COMM_WORLD );
+#endif
+          return counts;
+        };
+
+        const auto counts = global_counts();
+        REQUIRE( lb_exx.state().exx_costs_measured );
+        lb_exx.rebalance_exx();
+        CHECK( global_counts() == counts );
+
+        auto K_rebal = integrator->eval_exx( P );
+        CHECK( (K_rebal - K).norm() / basis.nbf() < 1e-10 );
+      }
+    }
+
+    // Check sn-J and the combined sn-J / sn-LinK path
+    if( ex == ExecutionSpace::Host and integrator_kernel == "Default" ) {
+      auto J = integrator->eval_coulomb( P );
+      CHECK( (J - J.transpose()).norm() < 1e-10 ); // Symmetric
+      CHECK( (P.cwiseProduct(J)).sum() > 0. );   // Positive Coulomb energy
+
+      // For a rank one density c c^T, the Coulomb and exchange energies
+      // are both (phi phi | phi phi): compare to the (validated) sn-LinK
+      {
+        Eigen::VectorXd c = P.col(0);
+        matrix_type P1 = c * c.transpose();
+        auto J1 = integrator->eval_coulomb( P1 );
+        auto K1 = integrator->eval_exx( P1 );
+        const double EJ1 = P1.cwiseProduct(J1).sum();
+        const double EK1 = P1.cwiseProduct(K1).sum();
+        CHECK( EJ1 > 0. );
+        CHECK( EJ1 == Approx( EK1 ).epsilon(1e-8) );
+      }
+
+      auto [J_ck, K_ck] = integrator->eval_coulomb_exx( P );
+      CHECK( (J_ck - J).norm() / basis.nbf() < 1e-12 );
+      CHECK( (K_ck - K_ref).norm() / basis.nbf() < 1e-7 );
+
+      // Energy only path
+      auto EXX = integrator->eval_exx_energy( P );
+      CHECK( EXX == Approx( (P.cwiseProduct(K)).sum() ) );
+
+      // Explicit shell pair integral engines
+      for( auto engine : {ShellPairIntegralEngine::ObaraSaika,
+                          ShellPairIntegralEngine::Rys} ) {
+        IntegratorSettingsSNLinK sn_link_settings;
+        sn_link_settings.integral_engine = engine;
+        auto K_eng = integrator->eval_exx( P, sn_link_settings );
+        CHECK( (K_eng - K).norm() / basis.nbf() < 1e-10 );
+      }
+
+      // The Auto engines are selected ahead of the task loop and agree
+      // across ranks
+      {
+        const auto* table = detail::ShellPairEngineTable::instance();
+        REQUIRE( table );
+        std::vector<int> selection;
+        for( int la = 0; la <= table->max_l; ++la )
+        for( int lb = 0; lb <= la; ++lb )
+        for( int nprim : table->nprim_class_bounds )
+          selection.push_back( int(table->select( la, lb, nprim )) );
+#ifdef GAUXC_HAS_MPI
+        auto selection_root = selection;
+        MPI_Bcast( selection_root.data(), selection_root.size(), MPI_INT, 0,
+          MPI_COMM_WORLD );
+        CHECK( selection == selection_root );
+#endif
+      }
+
+      // Far-field multipole approximation, the error is controlled by the
+      // multipole tolerance
+      for( double mp_tol : {1e-8, 1e-10} ) {
+        IntegratorSettingsSNLinK sn_link_settings;
+        sn_link_settings.multipole_tol = mp_tol;
+        auto K_mp = integrator->eval_exx( P, sn_link_settings );
+        CHECK( (K_mp - K_mp.transpose()).norm() < 1e-10 ); // Symmetric
+        CHECK( (K_mp - K).norm() / basis.nbf() < 1e3 * mp_tol );
+        CHECK( (K_mp - K_ref).norm() / basis.nbf() < 1e-7 + 1e3 * mp_tol );
+      }
+
+      // Range-separated exchange: long-range + short-range = full
+      {
+        IntegratorSettingsSNLinK lr_settings, sr_settings;
+        lr_settings.omega = 0.4; lr_settings.alpha = 0.; lr_settings.beta =  1.;
+        sr_settings.omega = 0.4; sr_settings.alpha = 1.; sr_settings.beta = -1.;
+        auto K_lr = integrator->eval_exx( P, lr_settings );
+        auto K_sr = integrator->eval_exx( P, sr_settings );
+        CHECK( (K_lr + K_sr - K).norm() / basis.nbf() < 1e-8 );
+
+        // Limits of the long-range operator: erf(omega*r)/r -> 1/r for
+        // omega -> inf, and erf(omega*r)/r -> 2*omega/sqrt(pi) for omega -> 0
+        lr_settings.omega = 1e6;
+        auto K_lr_inf = integrator->eval_exx( P, lr_settings );
+        CHECK( (K_lr_inf - K).norm() / basis.nbf() < 1e-6 );
+
+        lr_settings.omega = 1e-4;
+        auto K_lr_0 = integrator->eval_exx( P, lr_settings );
+        CHECK( K_lr_0.norm() < 1e-3 * K.norm() );
+        CHECK( K_lr_0.norm() > 0. );
+
+        // ... linear in omega
+        lr_settings.omega = 2e-4;
+        auto K_lr_0_2 = integrator->eval_exx( P, lr_settings );
+        CHECK( (K_lr_0_2 - 2. * K_lr_0).norm() < 1e-4 * K_lr_0.norm() );
+      }
+
+      // The cached task view must be invalidated by a geometry update
+      // (same task / point counts), compare to a freshly built integrator
+      {
+        auto K_old = integrator->eval_exx( P );
+        CHECK( (K_old - K).norm() / basis.nbf() < 1e-12 );
+
+        Molecule mol_new = mol;
+        mol_new[0].x += 0.02; mol_new[0].y -= 0.03;
+
+        auto& lb_upd = integrator->load_balancer();
+        lb_upd.update_geometry( mol_new );
+        mw.modify_weights( lb_upd );
+        auto K_upd = integrator->eval_exx( P );
+
+        auto lb_new = lb_factory.get_instance( rt, mol_new, mg, lb_upd.basis() );
+        mw.modify_weights( lb_new );
+        auto integrator_new = integrator_factory.get_instance( *func, lb_new );
+        auto K_new = integrator_new.eval_exx( P );
+
+        CHECK( (K_new - K).norm() / basis.nbf() > 1e-6 );
+        CHECK( (K_upd - K_new).norm() / basis.nbf() < 1e-10 );
+      }
+    }
   }
 
 }
@@ -453,6 +681,82 @@ std::shared_ptr<functional_type> make_functional(ExchCXX::Functional func_key, E
 }
 
 
+#ifdef GAUXC_HAS_HOST
+TEST_CASE( "sn-LinK Far-Field Multipoles", "[xc-integrator]" ) {
+
+  // s and p shells on two atoms, probed by points well beyond the far-field
+  // radius of all shell pairs such that the multipole branch is taken
+  Molecule mol;
+  mol.emplace_back( AtomicNumber(1), 0., 0., 0.  );
+  mol.emplace_back( AtomicNumber(1), 0., 0., 1.4 );
+
+  using prim_array = Shell<double>::prim_array;
+  using cart_array = Shell<double>::cart_array;
+  BasisSet<double> basis;
+  basis.emplace_back( PrimSize(2), AngularMomentum(0), SphericalType(false),
+    prim_array{ 3.0, 0.6 }, prim_array{ 0.4, 0.7 }, cart_array{ 0., 0., 0. } );
+  basis.emplace_back( PrimSize(1), AngularMomentum(1), SphericalType(false),
+    prim_array{ 0.8 }, prim_array{ 1.0 }, cart_array{ 0., 0., 1.4 } );
+  BasisSetMap basis_map( basis, mol );
+
+  ShellPairCollection<double> shpairs( basis );
+  shpairs.generate_multipoles( basis );
+
+  const size_t npts = 8;
+  std::vector<double> points, weights( npts, 0.5 );
+  for( size_t i = 0; i < npts; ++i ) {
+    points.push_back( 1000. + 0.2 * i );
+    points.push_back( 0.1 * (i % 3) );
+    points.push_back( -0.3 * (i % 2) );
+  }
+
+  const std::vector<int32_t> shell_list = { 0, 1 };
+  const std::vector<std::pair<int32_t,int32_t>> shell_pair_list = 
+    { {0,0}, {1,0}, {1,1} };
+
+  const double mp_tol = 1e-8;
+  for( auto [i,j] : shell_pair_list ) {
+    const auto& mp = shpairs.at(i,j).multipoles();
+    REQUIRE( not mp.empty() );
+    const double dist = std::hypot( 1000. - mp.center.x, mp.center.y, 
+      mp.center.z ) - 4.; // Bound on the extent of the points
+    REQUIRE( dist > mp.far_field_radius( mp_tol ) );
+  }
+
+  const size_t nbe = basis.nbf();
+  std::vector<double> X( nbe * npts );
+  for( size_t i = 0; i < X.size(); ++i ) X[i] = 1. - 0.1 * (i % 7);
+
+  auto lwd = LocalWorkDriverFactory::make_local_work_driver( 
+    ExecutionSpace::Host, "Reference" );
+  auto* host_lwd = dynamic_cast<LocalHostWorkDriver*>(lwd.get());
+
+  auto eval_gmat = [&]( double tol ) {
+    std::vector<double> G( nbe * npts, 0. );
+    host_lwd->eval_exx_gmat( npts, shell_list.size(), shell_pair_list.size(),
+      nbe, points.data(), weights.data(), basis, shpairs, basis_map,
+      shell_list.data(), shell_pair_list.data(), X.data(), nbe, G.data(), nbe,
+      tol, ShellPairIntegralEngine::Rys, 1., 0., 0. );
+    return G;
+  };
+
+  const auto G_exact = eval_gmat( 0. );
+  const auto G_mp    = eval_gmat( mp_tol );
+
+  // The multipole expansion is taken (the near-field path would reproduce
+  // G_exact) and accurate to the tolerance
+  double max_diff = 0., max_G = 0.;
+  for( size_t i = 0; i < G_exact.size(); ++i ) {
+    max_diff = std::max( max_diff, std::abs( G_mp[i] - G_exact[i] ) );
+    max_G    = std::max( max_G,    std::abs( G_exact[i] ) );
+  }
+  CHECK( max_G > 0. );
+  CHECK( max_diff > 0. );
+  CHECK( max_diff < 10. * nbe * mp_tol );
+
+}
+#endif
+
 TEST_CASE( "XC Integrator", "[xc-integrator]" ) {
 
   auto pol     = ExchCXX::Spin::Polarized;